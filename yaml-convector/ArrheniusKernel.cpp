@@ -0,0 +1,88 @@
+#include "ArrheniusKernel.h"
+#include "PhysicalConstants.h"
+#include "SimdMath.h"
+#include <cmath>
+#include <stdexcept>
+
+ArrheniusKernel::ArrheniusKernel(const std::vector<double>& A, const std::vector<double>& b,
+    const std::vector<double>& Ea) {
+    if (b.size() != A.size() || Ea.size() != A.size()) {
+        throw std::runtime_error("ArrheniusKernel: A、b、Ea 长度不一致");
+    }
+
+    const size_t count = A.size();
+    m_logA.resize(count);
+    m_b = b;
+    m_EaOverR.resize(count);
+    m_sign.resize(count);
+    for (size_t i = 0; i < count; i++) {
+        m_logA[i] = std::log(std::fabs(A[i]));
+        m_EaOverR[i] = Ea[i] / GasConstant;
+        m_sign[i] = A[i] < 0.0 ? -1.0 : 1.0;
+        m_hasNegative |= A[i] < 0.0;
+    }
+}
+
+ArrheniusKernel::ArrheniusKernel(const CompiledKinetics& kinetics)
+    : ArrheniusKernel(kinetics.A, kinetics.b, kinetics.Ea) {
+}
+
+const char* ArrheniusKernel::isaName() {
+    return simd::kIsaName;
+}
+
+void ArrheniusKernel::evaluate(double T, double* k) const {
+    evaluate(T, 0, size(), k);
+}
+
+void ArrheniusKernel::evaluate(double T, size_t begin, size_t end, double* k) const {
+    using simd::Vec;
+    const Vec logT = std::log(T);
+    const Vec invT = 1.0 / T;
+    const double* logA = m_logA.data() + begin;
+    const double* b = m_b.data() + begin;
+    const double* EaOverR = m_EaOverR.data() + begin;
+    const size_t count = end - begin;
+
+    size_t i = 0;
+    for (; i + simd::kWidth <= count; i += simd::kWidth) {
+        Vec e = fmadd(Vec::load(b + i), logT, Vec::load(logA + i));
+        e = e - Vec::load(EaOverR + i) * invT;
+        exp(e).store(k + i);
+    }
+    if (i < count) {
+        const size_t rest = count - i;
+        Vec e = fmadd(Vec::loadPartial(b + i, rest), logT, Vec::loadPartial(logA + i, rest));
+        e = e - Vec::loadPartial(EaOverR + i, rest) * invT;
+        exp(e).storePartial(k + i, rest);
+    }
+
+    if (m_hasNegative) {
+        const double* sign = m_sign.data() + begin;
+        for (size_t j = 0; j < count; j++) k[j] *= sign[j];
+    }
+}
+
+void ArrheniusKernel::evaluate(const double* T, size_t temperatureCount, double* k) const {
+    const size_t count = size();
+    for (size_t t = 0; t < temperatureCount; t++) {
+        evaluate(T[t], k + t * count);
+    }
+}
+
+void ArrheniusKernel::logDerivative(double T, size_t begin, size_t end, double* dlogkdT) const {
+    using simd::Vec;
+    const Vec invT = 1.0 / T;
+    const double* b = m_b.data() + begin;
+    const double* EaOverR = m_EaOverR.data() + begin;
+    const size_t count = end - begin;
+
+    size_t i = 0;
+    for (; i + simd::kWidth <= count; i += simd::kWidth) {
+        (fmadd(Vec::load(EaOverR + i), invT, Vec::load(b + i)) * invT).store(dlogkdT + i);
+    }
+    if (i < count) {
+        const size_t rest = count - i;
+        (fmadd(Vec::loadPartial(EaOverR + i, rest), invT, Vec::loadPartial(b + i, rest)) * invT).storePartial(dlogkdT + i, rest);
+    }
+}
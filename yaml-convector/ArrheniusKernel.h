@@ -0,0 +1,39 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+#include "CompiledKinetics.h"
+
+// ========== 批量 Arrhenius 速率常数 ==========
+// k = A * T^b * exp(-Ea/RT) 改写为 k = sign(A) * exp(ln|A| + b*lnT - (Ea/R)/T):
+// 构造时预先计算 ln|A| 和 Ea/R, 每个温度只计算一次 lnT 和 1/T, 之后每个反应只需两次乘加和一次 exp.
+// 向量路径见 SimdMath.h, 尾部不足一个向量宽度的部分用掩码读写.
+class ArrheniusKernel {
+public:
+    ArrheniusKernel() = default;
+    // 参数为SI单位, Ea 单位 J/kmol
+    ArrheniusKernel(const std::vector<double>& A, const std::vector<double>& b, const std::vector<double>& Ea);
+    // 所有反应的速率常数(衰减反应为高压限)
+    explicit ArrheniusKernel(const CompiledKinetics& kinetics);
+
+    size_t size() const { return m_logA.size(); }
+
+    // 单个温度: k[i], i 为反应下标
+    void evaluate(double T, double* k) const;
+    // 只计算反应 [begin, end): k[i - begin]
+    void evaluate(double T, size_t begin, size_t end, double* k) const;
+    // 一批温度: k[t * size() + i]
+    void evaluate(const double* T, size_t temperatureCount, double* k) const;
+
+    // 对温度的对数导数 d(ln k)/dT = (b + Ea/RT) / T: 只计算反应 [begin, end), 结果写入 dlogkdT[i - begin]
+    void logDerivative(double T, size_t begin, size_t end, double* dlogkdT) const;
+
+    // 当前编译使用的指令集: "AVX-512"、"AVX2" 或 "scalar"
+    static const char* isaName();
+
+private:
+    std::vector<double> m_logA;     // ln|A|, A 为0时为 -inf
+    std::vector<double> m_b;
+    std::vector<double> m_EaOverR;  // Ea/R [K]
+    std::vector<double> m_sign;     // sign(A), 只在存在负的 A 时使用
+    bool m_hasNegative = false;
+};
@@ -0,0 +1,65 @@
+#include "AtomicFile.h"
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <thread>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+
+unsigned long processId() {
+#ifdef _WIN32
+    return static_cast<unsigned long>(GetCurrentProcessId());
+#else
+    return static_cast<unsigned long>(getpid());
+#endif
+}
+
+// 同一进程内各线程、各次调用的临时文件名互不相同
+std::string uniqueTempPath(const std::string& file) {
+    static std::atomic<unsigned long long> counter{0};
+    return file + ".tmp." + std::to_string(processId())
+        + "." + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()))
+        + "." + std::to_string(counter.fetch_add(1));
+}
+
+bool replaceFile(const std::string& source, const std::string& target) {
+#ifdef _WIN32
+    return MoveFileExA(source.c_str(), target.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+    return std::rename(source.c_str(), target.c_str()) == 0;
+#endif
+}
+
+} // namespace
+
+bool writeFileAtomically(const std::string& file, const char* data, size_t size) {
+    const std::string tempFile = uniqueTempPath(file);
+    {
+        std::ofstream output(tempFile, std::ios::binary | std::ios::trunc);
+        if (!output) return false;
+        output.write(data, static_cast<std::streamsize>(size));
+        output.close();
+        if (!output) {
+            std::remove(tempFile.c_str());
+            return false;
+        }
+    }
+    if (!replaceFile(tempFile, file)) {
+        std::remove(tempFile.c_str());
+        return false;
+    }
+    return true;
+}
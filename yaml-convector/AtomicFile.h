@@ -0,0 +1,11 @@
+#pragma once
+#include <cstddef>
+#include <string>
+
+// ========== 原子替换写文件 ==========
+// 先写入目标同目录下唯一命名的临时文件(目标名 + ".tmp." + 进程号 + 线程 + 序号), 写完后用
+// rename(POSIX)或 MoveFileEx(MOVEFILE_REPLACE_EXISTING, Windows)一步替换目标, 不先删除目标:
+// 读者只会看到旧文件或完整的新文件, 已打开/映射旧文件的进程不受影响;
+// 多个进程或线程同时写同一目标时各写各的临时文件, 最后完成的替换生效.
+// 成功返回 true; 失败时删除临时文件并返回 false, 目标保持不变
+bool writeFileAtomically(const std::string& file, const char* data, size_t size);
@@ -0,0 +1,1888 @@
+#include "Benchmark.h"
+#include "ArrheniusKernel.h"
+#include "CompiledKinetics.h"
+#include "CompiledMechanism.h"
+#include "EquationTokenizer.h"
+#include "FalloffKernel.h"
+#include "KineticsEngine.h"
+#include "KineticsJacobian.h"
+#include "Mechanism.h"
+#include "MechanismBatchLoader.h"
+#include "MechanismCache.h"
+#include "MechanismStreamLoader.h"
+#include "MixtureTransport.h"
+#include "Nasa7Thermo.h"
+#include "Nasa9Thermo.h"
+#include "PhysicalConstants.h"
+#include "SpeciesTable.h"
+#include "StoichiometricMatrix.h"
+#include "ThirdBodyMatrix.h"
+#include "ThreadPool.h"
+#include "TransportFits.h"
+#include "YamlDocument.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <yaml-cpp/yaml.h>
+
+namespace {
+
+// 计时工具: 返回函数多次执行的平均耗时(毫秒)
+template <typename Func>
+double averageMs(int repeats, Func&& func) {
+    if (repeats < 1) repeats = 1;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < repeats; i++) {
+        func();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count() / repeats;
+}
+
+// 旧版 YamlValue 的数据成员布局(每个节点同时携带所有类型的成员), 仅用于对比 sizeof
+struct LegacyYamlValueLayout {
+    YamlValue::Type type;
+    std::string string;
+    double number;
+    bool boolean;
+    std::map<std::string, LegacyYamlValueLayout> map;
+    std::vector<LegacyYamlValueLayout> sequence;
+};
+
+// std::map 红黑树节点除键值对外的额外开销(颜色 + 三个指针)
+constexpr size_t kMapNodeOverhead = 4 * sizeof(void*);
+
+struct MemoryStats {
+    size_t nodes = 0;
+    size_t currentBytes = 0;
+    size_t legacyBytes = 0;
+};
+
+// 超出短字符串优化容量时的堆内存
+size_t stringHeapBytes(const std::string& str) {
+    static const size_t ssoCapacity = std::string().capacity();
+    return str.capacity() > ssoCapacity ? str.capacity() + 1 : 0;
+}
+
+// 递归统计节点的堆内存(节点自身的内联大小由父容器计入)
+void collectMemory(const YamlValue& value, MemoryStats& stats) {
+    stats.nodes++;
+
+    switch (value.type()) {
+    case YamlValue::Type::String:
+        stats.currentBytes += stringHeapBytes(value.asString());
+        stats.legacyBytes += stringHeapBytes(value.asString());
+        break;
+    case YamlValue::Type::Map: {
+        const auto& map = value.asMap();
+        stats.currentBytes += sizeof(YamlValue::MapType) + map.keyIndexHeapBytes();
+        for (const auto& [key, child] : map) {
+            stats.currentBytes += sizeof(std::pair<const std::string, YamlValue>) + kMapNodeOverhead;
+            stats.legacyBytes += sizeof(std::pair<const std::string, LegacyYamlValueLayout>) + kMapNodeOverhead;
+            stats.currentBytes += stringHeapBytes(key);
+            stats.legacyBytes += stringHeapBytes(key);
+            collectMemory(child, stats);
+        }
+        break;
+    }
+    case YamlValue::Type::Sequence: {
+        const auto& sequence = value.asSequence();
+        stats.currentBytes += sizeof(YamlValue::SequenceType) + sequence.capacity() * sizeof(YamlValue);
+        stats.legacyBytes += sequence.size() * sizeof(LegacyYamlValueLayout);
+        for (const auto& child : sequence) {
+            collectMemory(child, stats);
+        }
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+// 收集文档中所有标量的文本和标签, 用于单独测量标量分类的耗时
+class ScalarCollector : public YAML::EventHandler {
+public:
+    std::vector<std::pair<std::string, std::string>> scalars;
+
+    void OnDocumentStart(const YAML::Mark&) override {}
+    void OnDocumentEnd() override {}
+    void OnNull(const YAML::Mark&, YAML::anchor_t) override {}
+    void OnAlias(const YAML::Mark&, YAML::anchor_t) override {}
+    void OnScalar(const YAML::Mark&, const std::string& tag, YAML::anchor_t,
+        const std::string& value) override {
+        scalars.emplace_back(value, tag);
+    }
+    void OnSequenceStart(const YAML::Mark&, const std::string&, YAML::anchor_t,
+        YAML::EmitterStyle::value) override {}
+    void OnSequenceEnd() override {}
+    void OnMapStart(const YAML::Mark&, const std::string&, YAML::anchor_t,
+        YAML::EmitterStyle::value) override {}
+    void OnMapEnd() override {}
+};
+
+
+// 旧版反应方程解析(stringstream + substr, 每个词和物种名都分配字符串), 仅用于对比分词耗时
+void legacyParseEquation(const std::string& equation,
+    std::map<std::string, double>& reactants, std::map<std::string, double>& products) {
+    reactants.clear();
+    products.clear();
+
+    // 去掉衰减碰撞体 "(+M)"/"(+AR)"
+    std::string stripped = equation;
+    size_t pos = 0;
+    while ((pos = stripped.find("(+", pos)) != std::string::npos) {
+        size_t close = stripped.find(')', pos);
+        if (close == std::string::npos) break;
+        bool attached = pos > 0 && stripped[pos - 1] != ' ';
+        if (close == pos + 2 || attached) {
+            pos = close + 1;
+            continue;
+        }
+        stripped.erase(pos, close - pos + 1);
+    }
+
+    size_t arrowPos = stripped.find("<=>");
+    size_t arrowLength = 3;
+    if (arrowPos == std::string::npos) {
+        arrowPos = stripped.find("=>");
+        arrowLength = 2;
+        if (arrowPos == std::string::npos) {
+            arrowPos = stripped.find("=");
+            arrowLength = 1;
+        }
+    }
+    if (arrowPos == std::string::npos) return;
+
+    auto parseSide = [](const std::string& side, std::map<std::string, double>& species) {
+        std::stringstream ss(side);
+        std::string token;
+        double stoich = 1.0;
+        while (ss >> token) {
+            if (token == "+" || token == "M") continue;
+            if (isdigit(static_cast<unsigned char>(token[0]))) {
+                size_t endPos;
+                double value = std::stod(token, &endPos);
+                if (endPos == token.length()) {
+                    stoich = value;
+                    continue;
+                }
+                species[token.substr(endPos)] += value;
+                stoich = 1.0;
+                continue;
+            }
+            species[token] += stoich;
+            stoich = 1.0;
+        }
+    };
+    parseSide(stripped.substr(0, arrowPos), reactants);
+    parseSide(stripped.substr(arrowPos + arrowLength), products);
+}
+
+// 旧式逐反应计算所需的方程数据(只解析一次)
+struct LegacyReaction {
+    std::map<std::string, double> reactants;
+    std::map<std::string, double> products;
+    std::string collider;           // 三体/衰减反应的碰撞体, "M" 为全部物种
+    bool reversible = true;
+    size_t falloff = SIZE_MAX;      // 在 CompiledKinetics::falloff 中的下标
+};
+
+std::vector<LegacyReaction> legacyReactions(const MechanismData& mechanism, const CompiledKinetics& kinetics) {
+    std::vector<LegacyReaction> legacy(mechanism.reactions.size());
+    std::vector<EquationTerm> terms;
+    for (size_t r = 0; r < legacy.size(); r++) {
+        const std::string& equation = mechanism.reactions[r].equation;
+        parseReactionEquation(equation, legacy[r].reactants, legacy[r].products);
+        ParsedEquation parsed = tokenizeEquation(equation, terms);
+        legacy[r].collider = std::string(parsed.collider);
+        legacy[r].reversible = parsed.reversible;
+    }
+    for (size_t j = 0; j < kinetics.falloff.size(); j++) legacy[kinetics.falloff.reaction[j]].falloff = j;
+    return legacy;
+}
+
+// 逐反应按物种名计算净生成速率: 浓度、g/RT 和生成速率都存放在 std::map 中,
+// 每个反应单独计算速率常数、第三体浓度和平衡常数, 浓度幂次一律用 pow
+void legacyProductionRates(const MechanismData& mechanism, const CompiledKinetics& kinetics,
+    const std::vector<LegacyReaction>& legacy, double T, const std::map<std::string, double>& concentrations,
+    std::map<std::string, double>& wdot, std::vector<double>& forward, std::vector<double>& reverse) {
+    // g/RT 直接由 ThermoData 计算
+    std::map<std::string, double> gRT;
+    const double logT = std::log(T);
+    for (const ThermoData& species : mechanism.thermoSpecies) {
+        if (species.coefficients.low.size() == 7) {
+            const auto& a = (species.temperatureRanges.size() >= 3 && T > species.temperatureRanges[1]
+                && species.coefficients.high.size() == 7) ? species.coefficients.high : species.coefficients.low;
+            double h = a[0] + a[1] * T / 2 + a[2] * T * T / 3 + a[3] * T * T * T / 4 + a[4] * T * T * T * T / 5 + a[5] / T;
+            double s = a[0] * logT + a[1] * T + a[2] * T * T / 2 + a[3] * T * T * T / 3 + a[4] * T * T * T * T / 4 + a[6];
+            gRT[species.name] = h - s;
+        }
+        else if (!species.nasa9Coeffs.empty()) {
+            const ThermoData::NASA9Range* range = &species.nasa9Coeffs.front();
+            for (const auto& candidate : species.nasa9Coeffs) {
+                range = &candidate;
+                if (T <= candidate.temperatureRange[1]) break;
+            }
+            const auto& a = range->coefficients;
+            double h = -a[0] / (T * T) + a[1] * logT / T + a[2] + a[3] * T / 2 + a[4] * T * T / 3
+                + a[5] * T * T * T / 4 + a[6] * T * T * T * T / 5 + a[7] / T;
+            double s = -a[0] / (2 * T * T) - a[1] / T + a[2] * logT + a[3] * T + a[4] * T * T / 2
+                + a[5] * T * T * T / 3 + a[6] * T * T * T * T / 4 + a[8];
+            gRT[species.name] = h - s;
+        }
+    }
+
+    auto concentration = [&](const std::string& name) {
+        auto it = concentrations.find(name);
+        return it == concentrations.end() ? 0.0 : it->second;
+    };
+
+    wdot.clear();
+    const double logStandardConcentration = std::log(OneAtm / (GasConstant * T));
+    for (size_t r = 0; r < legacy.size(); r++) {
+        const ReactionData& reaction = mechanism.reactions[r];
+        const LegacyReaction& equation = legacy[r];
+        double k = kinetics.A[r] * std::pow(T, kinetics.b[r]) * std::exp(-kinetics.Ea[r] / (GasConstant * T));
+
+        if (kinetics.type[r] != ReactionType::Elementary) {
+            double M = 0.0;
+            if (!equation.collider.empty() && equation.collider != "M") {
+                M = concentration(equation.collider);
+            }
+            else {
+                for (const auto& [name, value] : concentrations) {
+                    auto it = reaction.efficiencies.find(name);
+                    M += (it == reaction.efficiencies.end() ? 1.0 : it->second) * value;
+                }
+            }
+            if (equation.falloff == SIZE_MAX) {
+                k *= M;
+            }
+            else {
+                const FalloffBlock& falloff = kinetics.falloff;
+                const size_t j = equation.falloff;
+                double kLow = falloff.lowA[j] * std::pow(T, falloff.lowB[j]) * std::exp(-falloff.lowEa[j] / (GasConstant * T));
+                double pr = kLow * M / k;
+                double F = 1.0;
+                if (j < falloff.troeCount) {
+                    double a = falloff.troeA[j];
+                    double fcent = 0.0;
+                    if (falloff.troeT3[j] != 0.0) fcent += (1.0 - a) * std::exp(-T / falloff.troeT3[j]);
+                    if (falloff.troeT1[j] != 0.0) fcent += a * std::exp(-T / falloff.troeT1[j]);
+                    if (falloff.troeT2[j] != 0.0) fcent += std::exp(-falloff.troeT2[j] / T);
+                    double logFcent = std::log10(std::max(fcent, 1e-300));
+                    double c = -0.4 - 0.67 * logFcent;
+                    double n = 0.75 - 1.27 * logFcent;
+                    double x = std::log10(std::max(pr, 1e-300)) + c;
+                    double f1 = x / (n - 0.14 * x);
+                    F = std::pow(10.0, logFcent / (1.0 + f1 * f1));
+                }
+                k *= pr / (1.0 + pr) * F;
+            }
+        }
+
+        double qf = k;
+        for (const auto& [name, nu] : equation.reactants) {
+            auto order = reaction.orders.find(name);
+            if (order == reaction.orders.end()) qf *= std::pow(concentration(name), nu);
+        }
+        for (const auto& [name, order] : reaction.orders) qf *= std::pow(std::max(concentration(name), 0.0), order);
+
+        double qr = 0.0;
+        if (equation.reversible) {
+            double exponent = 0.0;
+            for (const auto& [name, nu] : equation.products) exponent += nu * (gRT.at(name) - logStandardConcentration);
+            for (const auto& [name, nu] : equation.reactants) exponent -= nu * (gRT.at(name) - logStandardConcentration);
+            qr = k * std::exp(std::min(exponent, 690.0));
+            for (const auto& [name, nu] : equation.products) qr *= std::pow(concentration(name), nu);
+        }
+
+        forward[r] = qf;
+        reverse[r] = qr;
+        for (const auto& [name, nu] : equation.reactants) wdot[name] -= nu * (qf - qr);
+        for (const auto& [name, nu] : equation.products) wdot[name] += nu * (qf - qr);
+    }
+}
+
+} // namespace
+
+void benchmarkLoadMechanism(const std::string& yamlFile, int repeats) {
+    std::cout << "[基准] 机理加载: " << yamlFile << std::endl;
+
+    size_t count = 0;
+
+    // 旧方式: 每个提取函数各自读取并解析一次文件
+    double separateMs = averageMs(repeats, [&]() {
+        count = extractKinetics(yamlFile).size()
+            + extractThermo(yamlFile).size()
+            + extractTransport(yamlFile).size();
+    });
+
+    // 新方式: 读取解析一次, 共享同一文档
+    double sharedMs = averageMs(repeats, [&]() {
+        MechanismData mechanism = loadMechanism(yamlFile, false, false);
+        count = mechanism.reactions.size()
+            + mechanism.thermoSpecies.size()
+            + mechanism.transportSpecies.size();
+    });
+
+    std::cout << "  记录数: " << count << std::endl;
+    std::cout << "  分别解析(3次): " << separateMs << " ms" << std::endl;
+    std::cout << "  共享文档(1次): " << sharedMs << " ms" << std::endl;
+    if (sharedMs > 0.0) {
+        std::cout << "  加速比: " << separateMs / sharedMs << "x" << std::endl;
+    }
+}
+
+void benchmarkStreamingLoad(const std::string& yamlFile, int repeats) {
+    std::cout << "[基准] 流式加载: " << yamlFile << std::endl;
+
+    size_t treeCount = 0;
+    size_t streamCount = 0;
+
+    double treeMs = averageMs(repeats, [&]() {
+        MechanismData mechanism = loadMechanism(yamlFile, false, false);
+        treeCount = mechanism.reactions.size()
+            + mechanism.thermoSpecies.size()
+            + mechanism.transportSpecies.size();
+    });
+
+    double streamMs = averageMs(repeats, [&]() {
+        MechanismData mechanism = loadMechanismStreaming(yamlFile);
+        streamCount = mechanism.reactions.size()
+            + mechanism.thermoSpecies.size()
+            + mechanism.transportSpecies.size();
+    });
+
+    std::cout << "  记录数: " << treeCount << " / " << streamCount << std::endl;
+    std::cout << "  完整文档树: " << treeMs << " ms" << std::endl;
+    std::cout << "  流式事件:   " << streamMs << " ms" << std::endl;
+    if (streamMs > 0.0) {
+        std::cout << "  加速比: " << treeMs / streamMs << "x" << std::endl;
+    }
+}
+
+void benchmarkYamlValueMemory(const std::string& yamlFile) {
+    std::cout << "[基准] YamlValue内存占用: " << yamlFile << std::endl;
+
+    YamlValue doc = YamlParser::loadFile(yamlFile);
+
+    MemoryStats stats;
+    stats.currentBytes += sizeof(YamlValue);
+    stats.legacyBytes += sizeof(LegacyYamlValueLayout);
+    collectMemory(doc, stats);
+
+    if (stats.nodes == 0) return;
+
+    std::cout << "  节点数: " << stats.nodes << std::endl;
+    std::cout << "  sizeof: 旧布局 " << sizeof(LegacyYamlValueLayout)
+        << " B, 标签联合 " << sizeof(YamlValue) << " B" << std::endl;
+    std::cout << "  每节点字节数(估算): 旧布局 "
+        << static_cast<double>(stats.legacyBytes) / stats.nodes << " B, 标签联合 "
+        << static_cast<double>(stats.currentBytes) / stats.nodes << " B" << std::endl;
+    std::cout << "  总计: 旧布局 " << stats.legacyBytes / (1024.0 * 1024.0) << " MB, 标签联合 "
+        << stats.currentBytes / (1024.0 * 1024.0) << " MB" << std::endl;
+}
+
+void benchmarkArenaDocument(const std::string& yamlFile, int repeats) {
+    std::cout << "[基准] 扁平化文档: " << yamlFile << std::endl;
+
+    double treeParseMs = 0.0, treeExtractMs = 0.0, treeFreeMs = 0.0;
+    double arenaParseMs = 0.0, arenaExtractMs = 0.0, arenaFreeMs = 0.0;
+    size_t arenaBytes = 0;
+    size_t arenaNodes = 0;
+
+    for (int i = 0; i < repeats; i++) {
+        auto doc = std::make_unique<YamlValue>();
+        treeParseMs += averageMs(1, [&]() { *doc = YamlParser::loadFile(yamlFile); });
+        treeExtractMs += averageMs(1, [&]() { loadMechanism(*doc); });
+        treeFreeMs += averageMs(1, [&]() { doc.reset(); });
+
+        auto arena = std::make_unique<YamlDocument>();
+        arenaParseMs += averageMs(1, [&]() { *arena = YamlParser::loadDocument(yamlFile); });
+        arenaExtractMs += averageMs(1, [&]() { loadMechanism(*arena); });
+        arenaBytes = arena->memoryBytes();
+        arenaNodes = arena->nodeCount();
+        arenaFreeMs += averageMs(1, [&]() { arena.reset(); });
+    }
+
+    int n = repeats < 1 ? 1 : repeats;
+    std::cout << "  YamlValue树:  解析 " << treeParseMs / n << " ms, 提取 " << treeExtractMs / n
+        << " ms, 释放 " << treeFreeMs / n << " ms" << std::endl;
+    std::cout << "  YamlDocument: 解析 " << arenaParseMs / n << " ms, 提取 " << arenaExtractMs / n
+        << " ms, 释放 " << arenaFreeMs / n << " ms" << std::endl;
+    std::cout << "  YamlDocument: " << arenaNodes << " 个节点, "
+        << arenaBytes / (1024.0 * 1024.0) << " MB (单块内存)" << std::endl;
+}
+
+void benchmarkExtraction(const std::string& yamlFile, int repeats) {
+    std::cout << "[基准] 字段提取: " << yamlFile << std::endl;
+
+    YamlValue doc = YamlParser::loadFile(yamlFile);
+    YamlDocument arena = YamlParser::loadDocument(yamlFile);
+
+    size_t reactions = 0;
+    size_t species = 0;
+
+    double treeMs = averageMs(repeats, [&]() {
+        reactions = extractKinetics(doc).size();
+        species = extractThermo(doc).size();
+    });
+
+    double arenaMs = averageMs(repeats, [&]() {
+        reactions = extractKinetics(arena).size();
+        species = extractThermo(arena).size();
+    });
+
+    std::cout << "  " << reactions << " 个反应, " << species << " 个物种" << std::endl;
+    std::cout << "  YamlValue树:  " << treeMs << " ms" << std::endl;
+    std::cout << "  YamlDocument: " << arenaMs << " ms" << std::endl;
+}
+
+void benchmarkScalarParse(const std::string& yamlFile, int repeats) {
+    std::cout << "[基准] 标量解析: " << yamlFile << std::endl;
+
+    std::ifstream input(yamlFile);
+    if (!input) {
+        std::cerr << "错误: 无法打开文件 " << yamlFile << std::endl;
+        return;
+    }
+    ScalarCollector collector;
+    YAML::Parser parser(input);
+    parser.HandleNextDocument(collector);
+
+    size_t numbers = 0;
+    double classifyMs = averageMs(repeats, [&]() {
+        numbers = 0;
+        for (const auto& [value, tag] : collector.scalars) {
+            if (YamlValue::fromScalar(value, tag).isNumber()) numbers++;
+        }
+    });
+
+    double treeMs = averageMs(repeats, [&]() { YamlParser::loadFile(yamlFile); });
+    double arenaMs = averageMs(repeats, [&]() { YamlParser::loadDocument(yamlFile); });
+
+    std::cout << "  " << collector.scalars.size() << " 个标量, 其中 " << numbers << " 个数值" << std::endl;
+    std::cout << "  标量分类:     " << classifyMs << " ms" << std::endl;
+    std::cout << "  YamlValue树:  解析 " << treeMs << " ms" << std::endl;
+    std::cout << "  YamlDocument: 解析 " << arenaMs << " ms" << std::endl;
+}
+
+void benchmarkLazyLoad(const std::string& yamlFile, size_t selectCount, int repeats) {
+    std::cout << "[基准] 延迟转换: " << yamlFile << std::endl;
+
+    // 只读取前 selectCount 个物种的热力学数据
+    size_t extracted = 0;
+    auto selectThermo = [&](const YamlValue& root) {
+        extracted = 0;
+        if (!root.isMap()) return;
+        auto speciesField = root.asMap().get(SchemaKey::Species);
+        if (!speciesField || !speciesField->isSequence()) return;
+        const auto& speciesList = speciesField->asSequence();
+        for (size_t i = 0; i < speciesList.size() && i < selectCount; i++) {
+            ThermoData thermo;
+            if (extractThermoSpecies(speciesList[i], i, thermo)) extracted++;
+        }
+    };
+
+    double eagerMs = averageMs(repeats, [&]() {
+        YamlValue root = YamlParser::loadFile(yamlFile);
+        selectThermo(root);
+    });
+
+    double lazyMs = averageMs(repeats, [&]() {
+        YamlValue root = YamlParser::loadFileLazy(yamlFile);
+        selectThermo(root);
+    });
+
+    YAML::Node node;
+    double nodeMs = averageMs(repeats, [&]() { node = YAML::LoadFile(yamlFile); });
+
+    std::cout << "  读取 " << extracted << " 个物种的热力学数据" << std::endl;
+    std::cout << "  其中 YAML::LoadFile 本身: " << nodeMs << " ms" << std::endl;
+    std::cout << "  完整转换: " << eagerMs << " ms" << std::endl;
+    std::cout << "  延迟转换: " << lazyMs << " ms" << std::endl;
+}
+
+void benchmarkMechanismCache(const std::string& yamlFile, int repeats) {
+    std::cout << "[基准] 二进制缓存: " << yamlFile << std::endl;
+
+    size_t count = 0;
+    double yamlMs = averageMs(repeats, [&]() {
+        count = loadMechanism(yamlFile, false, false).reactions.size();
+    });
+
+    // 第一次调用写入缓存, 之后均命中缓存
+    double rebuildMs = averageMs(1, [&]() {
+        std::remove(mechanismCachePath(yamlFile).c_str());
+        loadMechanism(yamlFile, false, true);
+    });
+    double cachedMs = averageMs(repeats, [&]() {
+        count = loadMechanism(yamlFile, false, true).reactions.size();
+    });
+
+    std::cout << "  " << count << " 个反应" << std::endl;
+    std::cout << "  解析YAML:        " << yamlMs << " ms" << std::endl;
+    std::cout << "  解析并写入缓存:  " << rebuildMs << " ms" << std::endl;
+    std::cout << "  读取缓存:        " << cachedMs << " ms";
+    if (cachedMs > 0.0) std::cout << " (" << yamlMs / cachedMs << "x)";
+    std::cout << std::endl;
+}
+
+void benchmarkCompiledMechanism(const std::string& yamlFile, int repeats) {
+    std::cout << "[基准] 编译机理文件(mmap): " << yamlFile << std::endl;
+
+    MechanismData mechanism = loadMechanism(yamlFile, false, false);
+    std::string cacheFile = yamlFile + ".bench.mechcache";
+    std::string compiledFile = yamlFile + ".bench.mechbin";
+    try {
+        writeMechanismCache(cacheFile, mechanism, 0);
+        compileMechanism(mechanism, compiledFile);
+    }
+    catch (const std::exception& e) {
+        std::cerr << "错误: " << e.what() << std::endl;
+        return;
+    }
+
+    // 两种方式都读取全部反应的 A 值, 保证数据确实被访问
+    double sumCache = 0.0;
+    double cacheMs = averageMs(repeats, [&]() {
+        MechanismData cached;
+        readMechanismCache(cacheFile, 0, cached);
+        sumCache = 0.0;
+        for (const auto& reaction : cached.reactions) sumCache += reaction.rateConstant.A;
+    });
+
+    double sumCompiled = 0.0;
+    size_t compiledBytes = 0;
+    double compiledMs = averageMs(repeats, [&]() {
+        CompiledMechanism compiled = CompiledMechanism::open(compiledFile);
+        compiledBytes = compiled.fileBytes();
+        sumCompiled = 0.0;
+        for (double A : compiled.array<double>(CompiledSection::RateA)) sumCompiled += A;
+    });
+
+    std::remove(cacheFile.c_str());
+    std::remove(compiledFile.c_str());
+
+    std::cout << "  " << mechanism.reactions.size() << " 个反应, 编译文件 "
+        << compiledBytes / (1024.0 * 1024.0) << " MB" << std::endl;
+    std::cout << "  二进制缓存(反序列化): " << cacheMs << " ms" << std::endl;
+    std::cout << "  编译文件(mmap):       " << compiledMs << " ms"
+        << (sumCache == sumCompiled ? "" : " (结果不一致!)") << std::endl;
+}
+
+void benchmarkParallelThermo(const std::string& yamlFile, int repeats) {
+    std::cout << "[基准] 并行热力学提取: " << yamlFile << std::endl;
+
+    YamlValue doc = YamlParser::loadFile(yamlFile);
+    YamlDocument arena = YamlParser::loadDocument(yamlFile);
+
+    size_t species = 0;
+    double treeSerialMs = averageMs(repeats, [&]() { species = extractThermo(doc).size(); });
+    double arenaSerialMs = averageMs(repeats, [&]() { species = extractThermo(arena).size(); });
+    std::cout << "  " << species << " 个物种, 硬件线程数 " << std::thread::hardware_concurrency() << std::endl;
+    std::cout << "  串行:        YamlValue树 " << treeSerialMs << " ms, YamlDocument " << arenaSerialMs << " ms" << std::endl;
+
+    size_t maxThreads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    for (size_t threads = 1; ; threads *= 2) {
+        if (threads > maxThreads) threads = maxThreads;
+        double treeMs = averageMs(repeats, [&]() { extractThermoParallel(doc, threads); });
+        double arenaMs = averageMs(repeats, [&]() { extractThermoParallel(arena, threads); });
+        std::cout << "  并行 " << threads << " 线程: YamlValue树 " << treeMs << " ms, YamlDocument "
+            << arenaMs << " ms" << std::endl;
+        if (threads == maxThreads) break;
+    }
+}
+
+void benchmarkBatchLoad(const std::string& yamlFile, size_t fileCount, int repeats) {
+    std::cout << "[基准] 批量加载: " << yamlFile << " x " << fileCount << std::endl;
+
+    // 同一文件重复 fileCount 次, 不使用缓存, 测量完整的读取+解析+提取
+    std::vector<std::string> files(fileCount, yamlFile);
+
+    // 基准与 loadMechanisms 的单个任务相同(YamlDocument 解析), 只比较线程并发的效果
+    double sequentialMs = averageMs(repeats, [&]() {
+        for (const auto& file : files) loadMechanismFile(file, false);
+    });
+    std::cout << "  逐个 loadMechanismFile: " << sequentialMs << " ms, "
+        << fileCount * 1000.0 / sequentialMs << " 文件/秒" << std::endl;
+
+    size_t maxThreads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    for (size_t threads = 1; ; threads *= 2) {
+        if (threads > maxThreads) threads = maxThreads;
+        size_t failed = 0;
+        double batchMs = averageMs(repeats, [&]() {
+            failed = 0;
+            for (const auto& result : loadMechanisms(files, threads, false, false)) {
+                if (!result.success) failed++;
+            }
+        });
+        std::cout << "  loadMechanisms " << threads << " 线程: " << batchMs << " ms, "
+            << fileCount * 1000.0 / batchMs << " 文件/秒";
+        if (failed) std::cout << " (" << failed << " 个失败)";
+        std::cout << std::endl;
+        if (threads == maxThreads) break;
+    }
+}
+
+void benchmarkCompileKinetics(const std::string& yamlFile, int repeats) {
+    std::cout << "[基准] 动力学数据编译(数组结构): " << yamlFile << std::endl;
+
+    MechanismData mechanism = loadMechanism(yamlFile, false, false);
+    CompiledKinetics kinetics;
+    double compileMs = 0.0;
+    try {
+        compileMs = averageMs(repeats, [&]() { kinetics = compileKinetics(mechanism); });
+    }
+    catch (const std::exception& e) {
+        std::cerr << "错误: " << e.what() << std::endl;
+        return;
+    }
+
+    // 同一温度下计算全部反应的 k, 只比较内存布局: ReactionData 逐条读取 vs 连续数组
+    const double T = 1000.0;
+    const double invRT = 1.0 / (GasConstant * T);
+    double sumRecords = 0.0;
+    double recordsMs = averageMs(repeats, [&]() {
+        sumRecords = 0.0;
+        for (const auto& reaction : mechanism.reactions) {
+            const auto& rate = reaction.rateConstant;
+            sumRecords += rate.A * std::pow(T, rate.b) * std::exp(-rate.Ea * invRT);
+        }
+    });
+
+    double sumArrays = 0.0;
+    double arraysMs = averageMs(repeats, [&]() {
+        sumArrays = 0.0;
+        const size_t count = kinetics.reactionCount();
+        for (size_t i = 0; i < count; i++) {
+            sumArrays += kinetics.A[i] * std::pow(T, kinetics.b[i]) * std::exp(-kinetics.Ea[i] * invRT);
+        }
+    });
+
+    std::cout << "  " << kinetics.reactionCount() << " 个反应, 其中 " << kinetics.falloff.size()
+        << " 个衰减反应(" << kinetics.falloff.troeCount << " 个 Troe)" << std::endl;
+    std::cout << "  compileKinetics: " << compileMs << " ms" << std::endl;
+    std::cout << "  k(T) ReactionData: " << recordsMs << " ms (sum " << sumRecords << ", 未换算单位)" << std::endl;
+    std::cout << "  k(T) 数组结构:     " << arraysMs << " ms (sum " << sumArrays << ")" << std::endl;
+}
+
+void benchmarkArrheniusKernel(const std::string& yamlFile, size_t temperatureCount, int repeats) {
+    std::cout << "[基准] Arrhenius 速率常数(" << ArrheniusKernel::isaName() << "): " << yamlFile << std::endl;
+
+    CompiledKinetics kinetics;
+    try {
+        kinetics = compileKinetics(loadMechanism(yamlFile, false, false));
+    }
+    catch (const std::exception& e) {
+        std::cerr << "错误: " << e.what() << std::endl;
+        return;
+    }
+
+    const size_t count = kinetics.reactionCount();
+    std::vector<double> temperatures(temperatureCount);
+    for (size_t t = 0; t < temperatureCount; t++) {
+        temperatures[t] = 300.0 + 2700.0 * t / std::max<size_t>(temperatureCount - 1, 1);
+    }
+
+    // 逐个反应直接计算 A*T^b*exp(-Ea/RT)
+    std::vector<double> naive(count * temperatureCount);
+    auto evaluateNaive = [&](size_t t) {
+        const double T = temperatures[t];
+        double* k = naive.data() + t * count;
+        for (size_t i = 0; i < count; i++) {
+            k[i] = kinetics.A[i] * std::pow(T, kinetics.b[i]) * std::exp(-kinetics.Ea[i] / (GasConstant * T));
+        }
+    };
+
+    ArrheniusKernel kernel(kinetics);
+    std::vector<double> batched(count * temperatureCount);
+
+    double naiveSingleMs = averageMs(repeats, [&]() { evaluateNaive(0); });
+    double kernelSingleMs = averageMs(repeats, [&]() { kernel.evaluate(temperatures[0], batched.data()); });
+    double naiveBatchMs = averageMs(repeats, [&]() {
+        for (size_t t = 0; t < temperatureCount; t++) evaluateNaive(t);
+    });
+    double kernelBatchMs = averageMs(repeats, [&]() {
+        kernel.evaluate(temperatures.data(), temperatureCount, batched.data());
+    });
+
+    double maxRelError = 0.0;
+    for (size_t j = 0; j < naive.size(); j++) {
+        if (naive[j] != 0.0) maxRelError = std::max(maxRelError, std::fabs(batched[j] / naive[j] - 1.0));
+    }
+
+    std::cout << "  " << count << " 个反应, 1 个温度: 逐个计算 " << naiveSingleMs << " ms, 批量 "
+        << kernelSingleMs << " ms" << std::endl;
+    std::cout << "  " << count << " 个反应, " << temperatureCount << " 个温度: 逐个计算 " << naiveBatchMs
+        << " ms, 批量 " << kernelBatchMs << " ms" << std::endl;
+    std::cout << "  最大相对误差: " << maxRelError << std::endl;
+}
+
+void benchmarkFalloffKernel(const std::string& yamlFile, size_t stateCount, int repeats) {
+    std::cout << "[基准] 衰减反应速率常数(" << ArrheniusKernel::isaName() << "): " << yamlFile << std::endl;
+
+    CompiledKinetics kinetics;
+    try {
+        kinetics = compileKinetics(loadMechanism(yamlFile, false, false));
+    }
+    catch (const std::exception& e) {
+        std::cerr << "错误: " << e.what() << std::endl;
+        return;
+    }
+
+    FalloffKernel kernel(kinetics);
+    const FalloffBlock& falloff = kinetics.falloff;
+    const size_t count = kernel.size();
+    if (count == 0 || stateCount == 0) {
+        std::cout << "  没有衰减反应" << std::endl;
+        return;
+    }
+
+    // 温度 300-3000 K, [M] 覆盖低压到高压区(1e-5 - 10 kmol/m^3), 按反应存放: thirdBody[j * stateCount + s]
+    std::vector<double> temperatures(stateCount);
+    std::vector<double> thirdBody(stateCount * count);
+    for (size_t s = 0; s < stateCount; s++) {
+        temperatures[s] = 300.0 + 2700.0 * s / std::max<size_t>(stateCount - 1, 1);
+        for (size_t j = 0; j < count; j++) {
+            thirdBody[j * stateCount + s] = std::pow(10.0, -5.0 + 6.0 * ((s * 7 + j * 13) % 97) / 96.0);
+        }
+    }
+
+    // 逐个反应按公式计算
+    std::vector<double> naive(stateCount * count);
+    auto evaluateNaive = [&](size_t s) {
+        const double T = temperatures[s];
+        for (size_t j = 0; j < count; j++) {
+            size_t i = falloff.reaction[j];
+            double kHigh = kinetics.A[i] * std::pow(T, kinetics.b[i]) * std::exp(-kinetics.Ea[i] / (GasConstant * T));
+            double kLow = falloff.lowA[j] * std::pow(T, falloff.lowB[j]) * std::exp(-falloff.lowEa[j] / (GasConstant * T));
+            double pr = kLow * thirdBody[j * stateCount + s] / (kHigh + 1e-300);
+            double F = 1.0;
+            if (j < falloff.troeCount) {
+                double a = falloff.troeA[j];
+                double fcent = (1.0 - a) * std::exp(-T / falloff.troeT3[j]) + a * std::exp(-T / falloff.troeT1[j]);
+                if (falloff.troeT2[j] != 0.0) fcent += std::exp(-falloff.troeT2[j] / T);
+                double logFcent = std::log10(std::max(fcent, 1e-300));
+                double c = -0.4 - 0.67 * logFcent;
+                double n = 0.75 - 1.27 * logFcent;
+                double x = std::log10(std::max(pr, 1e-300)) + c;
+                double f1 = x / (n - 0.14 * x);
+                F = std::pow(10.0, logFcent / (1.0 + f1 * f1));
+            }
+            naive[j * stateCount + s] = kHigh * pr / (1.0 + pr) * F;
+        }
+    };
+
+    std::vector<double> batched(stateCount * count);
+    double naiveMs = averageMs(repeats, [&]() {
+        for (size_t s = 0; s < stateCount; s++) evaluateNaive(s);
+    });
+    double kernelMs = averageMs(repeats, [&]() {
+        kernel.evaluate(temperatures.data(), stateCount, thirdBody.data(), batched.data());
+    });
+
+    double maxRelError = 0.0;
+    for (size_t j = 0; j < naive.size(); j++) {
+        if (naive[j] != 0.0) maxRelError = std::max(maxRelError, std::fabs(batched[j] / naive[j] - 1.0));
+    }
+
+    std::cout << "  " << count << " 个衰减反应(" << kernel.troeCount() << " 个 Troe), " << stateCount
+        << " 个状态: 逐个计算 " << naiveMs << " ms, 批量 " << kernelMs << " ms" << std::endl;
+    std::cout << "  最大相对误差: " << maxRelError << std::endl;
+
+    // ThirdBodyMatrix 的批量 [M](行顺序与衰减反应一致)直接作为批量输入, 与逐个状态计算比较
+    const size_t species = kinetics.speciesCount;
+    ThirdBodyMatrix matrix(kinetics, kernel.reactions());
+    std::vector<double> concentrations(species * stateCount);
+    for (size_t k = 0; k < species; k++) {
+        for (size_t s = 0; s < stateCount; s++) {
+            concentrations[k * stateCount + s] = 1e-3 * (1 + (k * 31 + s * 17) % 101);
+        }
+    }
+    std::vector<double> chainedM(count * stateCount);
+    std::vector<double> chained(count * stateCount);
+    matrix.evaluate(concentrations.data(), stateCount, chainedM.data());
+    kernel.evaluate(temperatures.data(), stateCount, chainedM.data(), chained.data());
+
+    std::vector<double> state(species), stateM(count), stateK(count);
+    double chainError = 0.0;
+    for (size_t s = 0; s < stateCount; s++) {
+        for (size_t k = 0; k < species; k++) state[k] = concentrations[k * stateCount + s];
+        matrix.evaluate(state.data(), stateM.data());
+        kernel.evaluate(temperatures[s], stateM.data(), stateK.data());
+        for (size_t j = 0; j < count; j++) {
+            if (stateK[j] != 0.0) chainError = std::max(chainError, std::fabs(chained[j * stateCount + s] / stateK[j] - 1.0));
+        }
+    }
+    std::cout << "  批量 [M] -> 批量 k 与逐个状态的最大相对误差: " << chainError << std::endl;
+}
+
+void benchmarkThirdBodyMatrix(const std::string& yamlFile, size_t stateCount, int repeats) {
+    std::cout << "[基准] 第三体浓度 [M]: " << yamlFile << std::endl;
+
+    MechanismData mechanism = loadMechanism(yamlFile, false, false);
+    CompiledKinetics kinetics;
+    try {
+        kinetics = compileKinetics(mechanism);
+    }
+    catch (const std::exception& e) {
+        std::cerr << "错误: " << e.what() << std::endl;
+        return;
+    }
+
+    ThirdBodyMatrix matrix(kinetics);
+    const size_t species = kinetics.speciesCount;
+    const size_t rows = matrix.size();
+
+    // 按物种存放的浓度: concentrations[k * stateCount + s]
+    std::vector<double> concentrations(species * stateCount);
+    for (size_t k = 0; k < species; k++) {
+        for (size_t s = 0; s < stateCount; s++) {
+            concentrations[k * stateCount + s] = 1e-3 * (1 + (k * 31 + s * 17) % 101);
+        }
+    }
+
+    // 基准做法: 每个反应遍历按物种名索引的 efficiencies
+    std::unordered_map<std::string, size_t> speciesIndex;
+    for (size_t k = 0; k < species; k++) speciesIndex.emplace(kinetics.speciesNames[k], k);
+
+    std::vector<double> state(species);
+    std::vector<double> mapResult(rows * stateCount);
+    double mapMs = averageMs(repeats, [&]() {
+        for (size_t s = 0; s < stateCount; s++) {
+            double total = 0.0;
+            for (size_t k = 0; k < species; k++) {
+                state[k] = concentrations[k * stateCount + s];
+                total += state[k];
+            }
+            for (size_t r = 0; r < rows; r++) {
+                const ReactionData& reaction = mechanism.reactions[matrix.reactions()[r]];
+                double M = total;
+                for (const auto& [name, efficiency] : reaction.efficiencies) {
+                    M += (efficiency - 1.0) * state[speciesIndex.at(name)];
+                }
+                mapResult[r * stateCount + s] = M;
+            }
+        }
+    });
+
+    std::vector<double> single(rows);
+    std::vector<double> singleResult(rows * stateCount);
+    double singleMs = averageMs(repeats, [&]() {
+        for (size_t s = 0; s < stateCount; s++) {
+            for (size_t k = 0; k < species; k++) state[k] = concentrations[k * stateCount + s];
+            matrix.evaluate(state.data(), single.data());
+            for (size_t r = 0; r < rows; r++) singleResult[r * stateCount + s] = single[r];
+        }
+    });
+
+    std::vector<double> batched(rows * stateCount);
+    double batchedMs = averageMs(repeats, [&]() {
+        matrix.evaluate(concentrations.data(), stateCount, batched.data());
+    });
+
+    // 基准做法不处理指定碰撞体, 只比较默认效率为1的行
+    double maxRelError = 0.0;
+    for (size_t r = 0; r < rows; r++) {
+        if (kinetics.defaultEfficiency[matrix.reactions()[r]] != 1.0) continue;
+        for (size_t s = 0; s < stateCount; s++) {
+            size_t j = r * stateCount + s;
+            maxRelError = std::max(maxRelError, std::fabs(batched[j] / mapResult[j] - 1.0));
+            maxRelError = std::max(maxRelError, std::fabs(singleResult[j] / mapResult[j] - 1.0));
+        }
+    }
+
+    std::cout << "  " << rows << " 个三体/衰减反应, " << species << " 个物种, " << matrix.nonZeros()
+        << " 个非零元, " << stateCount << " 个状态" << std::endl;
+    std::cout << "  efficiencies(map):   " << mapMs << " ms" << std::endl;
+    std::cout << "  稀疏矩阵逐个状态:    " << singleMs << " ms" << std::endl;
+    std::cout << "  稀疏矩阵批量:        " << batchedMs << " ms" << std::endl;
+    std::cout << "  最大相对误差: " << maxRelError << std::endl;
+}
+
+void benchmarkNasa7Thermo(const std::string& yamlFile, size_t temperatureCount, int repeats) {
+    std::cout << "[基准] NASA7 热力学性质(" << ArrheniusKernel::isaName() << "): " << yamlFile << std::endl;
+
+    std::vector<ThermoData> thermo = extractThermo(yamlFile);
+    Nasa7Thermo evaluator(thermo);
+    const size_t count = evaluator.size();
+    if (count == 0 || temperatureCount == 0) {
+        std::cout << "  没有 NASA7 物种" << std::endl;
+        return;
+    }
+
+    std::vector<double> temperatures(temperatureCount);
+    for (size_t t = 0; t < temperatureCount; t++) {
+        temperatures[t] = 300.0 + 2700.0 * t / std::max<size_t>(temperatureCount - 1, 1);
+    }
+
+    // 逐个物种直接读取 ThermoData 计算
+    std::vector<double> naive(4 * temperatureCount * count);
+    double naiveMs = averageMs(repeats, [&]() {
+        for (size_t t = 0; t < temperatureCount; t++) {
+            const double T = temperatures[t];
+            for (size_t k = 0; k < count; k++) {
+                const ThermoData& species = thermo[evaluator.species()[k]];
+                const auto& a = (species.temperatureRanges.size() >= 3 && T > species.temperatureRanges[1]
+                    && species.coefficients.high.size() == 7) ? species.coefficients.high : species.coefficients.low;
+                const double T2 = T * T, T3 = T2 * T, T4 = T3 * T;
+                double cp = a[0] + a[1] * T + a[2] * T2 + a[3] * T3 + a[4] * T4;
+                double h = a[0] + a[1] * T / 2 + a[2] * T2 / 3 + a[3] * T3 / 4 + a[4] * T4 / 5 + a[5] / T;
+                double s = a[0] * std::log(T) + a[1] * T + a[2] * T2 / 2 + a[3] * T3 / 3 + a[4] * T4 / 4 + a[6];
+                size_t j = t * count + k;
+                naive[j] = cp;
+                naive[temperatureCount * count + j] = h;
+                naive[2 * temperatureCount * count + j] = s;
+                naive[3 * temperatureCount * count + j] = h - s;
+            }
+        }
+    });
+
+    std::vector<double> batched(4 * temperatureCount * count);
+    double* out = batched.data();
+    const size_t block = temperatureCount * count;
+    double evaluatorMs = averageMs(repeats, [&]() {
+        evaluator.evaluate(temperatures.data(), temperatureCount, out, out + block, out + 2 * block, out + 3 * block);
+    });
+
+    double maxAbsError = 0.0;
+    for (size_t j = 0; j < naive.size(); j++) {
+        maxAbsError = std::max(maxAbsError, std::fabs(batched[j] - naive[j]) / std::max(1.0, std::fabs(naive[j])));
+    }
+
+    std::cout << "  " << count << " 个物种, " << temperatureCount << " 个温度: 逐个计算 " << naiveMs
+        << " ms, Nasa7Thermo " << evaluatorMs << " ms" << std::endl;
+    std::cout << "  最大误差(相对, 小于1时按绝对): " << maxAbsError << std::endl;
+}
+
+void benchmarkNasa9Thermo(const std::string& yamlFile, size_t temperatureCount, int repeats) {
+    std::cout << "[基准] NASA9 热力学性质: " << yamlFile << std::endl;
+
+    std::vector<ThermoData> thermo = extractThermo(yamlFile);
+    Nasa9Thermo evaluator;
+    try {
+        evaluator = Nasa9Thermo(thermo);
+    }
+    catch (const std::exception& e) {
+        std::cerr << "错误: " << e.what() << std::endl;
+        return;
+    }
+    const size_t count = evaluator.size();
+    if (count == 0 || temperatureCount == 0) {
+        std::cout << "  没有 NASA9 物种" << std::endl;
+        return;
+    }
+
+    std::vector<double> temperatures(temperatureCount);
+    for (size_t t = 0; t < temperatureCount; t++) {
+        temperatures[t] = 300.0 + 19000.0 * t / std::max<size_t>(temperatureCount - 1, 1);
+    }
+
+    // 逐个物种线性查找温区, 直接读取 ThermoData 计算
+    std::vector<double> naive(4 * temperatureCount * count);
+    const size_t block = temperatureCount * count;
+    double naiveMs = averageMs(repeats, [&]() {
+        for (size_t t = 0; t < temperatureCount; t++) {
+            const double T = temperatures[t];
+            for (size_t k = 0; k < count; k++) {
+                const auto& ranges = thermo[evaluator.species()[k]].nasa9Coeffs;
+                size_t r = 0;
+                while (r + 1 < ranges.size() && T > ranges[r].temperatureRange[1]) r++;
+                const auto& a = ranges[r].coefficients;
+                const double T2 = T * T, T3 = T2 * T, T4 = T3 * T, logT = std::log(T);
+                double cp = a[0] / T2 + a[1] / T + a[2] + a[3] * T + a[4] * T2 + a[5] * T3 + a[6] * T4;
+                double h = -a[0] / T2 + a[1] * logT / T + a[2] + a[3] * T / 2 + a[4] * T2 / 3 + a[5] * T3 / 4
+                    + a[6] * T4 / 5 + a[7] / T;
+                double s = -a[0] / T2 / 2 - a[1] / T + a[2] * logT + a[3] * T + a[4] * T2 / 2 + a[5] * T3 / 3
+                    + a[6] * T4 / 4 + a[8];
+                size_t j = t * count + k;
+                naive[j] = cp;
+                naive[block + j] = h;
+                naive[2 * block + j] = s;
+                naive[3 * block + j] = h - s;
+            }
+        }
+    });
+
+    std::vector<double> batched(4 * block);
+    double* out = batched.data();
+    double evaluatorMs = averageMs(repeats, [&]() {
+        evaluator.evaluate(temperatures.data(), temperatureCount, out, out + block, out + 2 * block, out + 3 * block);
+    });
+
+    double maxError = 0.0;
+    for (size_t j = 0; j < naive.size(); j++) {
+        maxError = std::max(maxError, std::fabs(batched[j] - naive[j]) / std::max(1.0, std::fabs(naive[j])));
+    }
+
+    std::cout << "  " << count << " 个物种, " << evaluator.rangeCount() << " 个温区, " << temperatureCount
+        << " 个温度: 线性查找 " << naiveMs << " ms, Nasa9Thermo " << evaluatorMs << " ms" << std::endl;
+    std::cout << "  最大误差(相对, 小于1时按绝对): " << maxError << std::endl;
+}
+
+void benchmarkStoichiometricMatrix(const std::string& yamlFile, int repeats) {
+    std::cout << "[基准] 化学计量矩阵: " << yamlFile << std::endl;
+
+    MechanismData mechanism = loadMechanism(yamlFile, false, false);
+    StoichiometricMatrix stoich;
+    double compileMs = 0.0;
+    try {
+        compileMs = averageMs(repeats, [&]() { stoich = StoichiometricMatrix(mechanism); });
+    }
+    catch (const std::exception& e) {
+        std::cerr << "错误: " << e.what() << std::endl;
+        return;
+    }
+
+    const size_t reactions = stoich.reactionCount();
+    const size_t species = stoich.speciesCount();
+    std::vector<double> rates(reactions);
+    for (size_t r = 0; r < reactions; r++) rates[r] = 1e-3 * (1 + (r * 37) % 113) * (r % 3 == 0 ? -1.0 : 1.0);
+
+    std::unordered_map<std::string, size_t> speciesIndex;
+    for (size_t k = 0; k < species; k++) speciesIndex.emplace(mechanism.species.name(static_cast<uint32_t>(k)), k);
+
+    // 每次调用都解析方程(parseReactionEquation), 按物种名累加
+    std::vector<double> parsed(species);
+    double parseMs = averageMs(repeats, [&]() {
+        std::fill(parsed.begin(), parsed.end(), 0.0);
+        std::map<std::string, double> reactants, products;
+        for (size_t r = 0; r < reactions; r++) {
+            parseReactionEquation(mechanism.reactions[r].equation, reactants, products);
+            for (const auto& [name, nu] : reactants) parsed[speciesIndex.at(name)] -= nu * rates[r];
+            for (const auto& [name, nu] : products) parsed[speciesIndex.at(name)] += nu * rates[r];
+        }
+    });
+
+    std::vector<double> wdot(species);
+    double matrixMs = averageMs(repeats, [&]() { stoich.productionRates(rates.data(), wdot.data()); });
+
+    double maxError = 0.0;
+    for (size_t k = 0; k < species; k++) {
+        maxError = std::max(maxError, std::fabs(wdot[k] - parsed[k]) / std::max(1.0, std::fabs(parsed[k])));
+    }
+
+    std::cout << "  " << reactions << " 个反应, " << species << " 个物种, 反应物 " << stoich.reactants().nonZeros()
+        << " / 产物 " << stoich.products().nonZeros() << " / 净 " << stoich.netBySpecies().nonZeros() << " 个非零元" << std::endl;
+    std::cout << "  编译: " << compileMs << " ms" << std::endl;
+    std::cout << "  生成速率: 每次解析方程 " << parseMs << " ms, 稀疏矩阵 " << matrixMs << " ms" << std::endl;
+    std::cout << "  最大误差: " << maxError << std::endl;
+}
+
+void benchmarkEquationTokenizer(const std::string& yamlFile, int repeats) {
+    std::cout << "[基准] 反应方程分词: " << yamlFile << std::endl;
+
+    MechanismData mechanism = loadMechanism(yamlFile, false, false);
+    const auto& reactions = mechanism.reactions;
+    size_t characters = 0;
+    for (const auto& reaction : reactions) characters += reaction.equation.size();
+
+    std::map<std::string, double> reactants, products;
+    size_t legacyTerms = 0;
+    double legacyMs = averageMs(repeats, [&]() {
+        legacyTerms = 0;
+        for (const auto& reaction : reactions) {
+            legacyParseEquation(reaction.equation, reactants, products);
+            legacyTerms += reactants.size() + products.size();
+        }
+    });
+
+    std::vector<EquationTerm> terms;
+    terms.reserve(16);
+    size_t tokenizedTerms = 0;
+    size_t failures = 0;
+    double tokenizerMs = averageMs(repeats, [&]() {
+        tokenizedTerms = 0;
+        failures = 0;
+        for (const auto& reaction : reactions) {
+            try {
+                tokenizeEquation(reaction.equation, terms);
+                tokenizedTerms += terms.size();
+            }
+            catch (const std::exception&) {
+                failures++;
+            }
+        }
+    });
+
+    // 逐条比较两种解析的结果(物种名和化学计量数)
+    size_t mismatches = 0;
+    std::map<std::string, double> tokenReactants, tokenProducts;
+    for (const auto& reaction : reactions) {
+        legacyParseEquation(reaction.equation, reactants, products);
+        parseReactionEquation(reaction.equation, tokenReactants, tokenProducts);
+        if (reactants != tokenReactants || products != tokenProducts) mismatches++;
+    }
+
+    auto throughput = [&](double ms) { return ms > 0.0 ? reactions.size() / ms * 1e-3 : 0.0; };
+    std::cout << "  " << reactions.size() << " 个方程, " << characters << " 个字符, " << tokenizedTerms << " 项"
+        << " (旧版 " << legacyTerms << " 项)" << std::endl;
+    std::cout << "  旧版 stringstream: " << legacyMs << " ms (" << throughput(legacyMs) << " M 方程/秒)" << std::endl;
+    std::cout << "  string_view 分词: " << tokenizerMs << " ms (" << throughput(tokenizerMs) << " M 方程/秒)";
+    if (tokenizerMs > 0.0) std::cout << ", 加速 " << legacyMs / tokenizerMs << "x";
+    std::cout << std::endl;
+    std::cout << "  结果不一致: " << mismatches << " 个, 格式错误: " << failures << " 个" << std::endl;
+}
+
+void benchmarkSpeciesTable(const std::string& yamlFile, int repeats) {
+    std::cout << "[基准] 物种表: " << yamlFile << std::endl;
+
+    MechanismData mechanism = loadMechanism(yamlFile, false, false);
+    const std::vector<std::string>& names = mechanism.species.names();
+
+    // 机理中全部物种引用: 方程中的物种、碰撞体、第三体效率和反应级数的键
+    std::vector<std::string_view> references;
+    std::vector<EquationTerm> terms;
+    for (const auto& reaction : mechanism.reactions) {
+        try {
+            ParsedEquation parsed = tokenizeEquation(reaction.equation, terms);
+            for (const auto& term : terms) references.push_back(term.species);
+            if (parsed.thirdBody == ThirdBodyMarker::Falloff && parsed.collider != "M") {
+                references.push_back(parsed.collider);
+            }
+        }
+        catch (const std::exception&) {
+        }
+        for (const auto& item : reaction.efficiencies) references.push_back(item.first);
+        for (const auto& item : reaction.orders) references.push_back(item.first);
+    }
+
+    std::unordered_map<std::string, uint32_t> map;
+    double mapBuildMs = averageMs(repeats, [&]() {
+        map.clear();
+        map.reserve(names.size());
+        for (size_t k = 0; k < names.size(); k++) map.emplace(names[k], static_cast<uint32_t>(k));
+    });
+    SpeciesTable table;
+    double tableBuildMs = averageMs(repeats, [&]() { table = SpeciesTable(names); });
+
+    // 以 string_view 查找: unordered_map<std::string> 需要先构造字符串
+    uint64_t mapSum = 0;
+    double mapMs = averageMs(repeats, [&]() {
+        mapSum = 0;
+        for (std::string_view name : references) {
+            auto it = map.find(std::string(name));
+            mapSum += it != map.end() ? it->second : SpeciesTable::npos;
+        }
+    });
+    uint64_t tableSum = 0;
+    double tableMs = averageMs(repeats, [&]() {
+        tableSum = 0;
+        for (std::string_view name : references) tableSum += table.find(name);
+    });
+
+    auto perLookup = [&](double ms) { return references.empty() ? 0.0 : ms * 1e6 / references.size(); };
+    std::cout << "  " << names.size() << " 个物种, " << references.size() << " 次查找" << std::endl;
+    std::cout << "  建表: unordered_map " << mapBuildMs << " ms, SpeciesTable " << tableBuildMs << " ms" << std::endl;
+    std::cout << "  查找: unordered_map<std::string> " << mapMs << " ms (" << perLookup(mapMs) << " ns/次), SpeciesTable "
+        << tableMs << " ms (" << perLookup(tableMs) << " ns/次)";
+    if (tableMs > 0.0) std::cout << ", 加速 " << mapMs / tableMs << "x";
+    std::cout << std::endl;
+    std::cout << "  结果" << (mapSum == tableSum ? "一致" : "不一致") << std::endl;
+}
+
+void benchmarkTransportFits(const std::string& yamlFile, size_t speciesLimit, size_t temperatureCount, int repeats) {
+    std::cout << "[基准] 纯物种输运性质拟合(" << ArrheniusKernel::isaName() << "): " << yamlFile << std::endl;
+
+    MechanismData mechanism = loadMechanism(yamlFile, false, false);
+    if (mechanism.transportSpecies.size() > speciesLimit) {
+        mechanism.transportSpecies.resize(speciesLimit);
+        indexSpecies(mechanism);
+    }
+
+    TransportFits fits;
+    double buildMs = 0.0;
+    try {
+        buildMs = averageMs(1, [&]() { fits = TransportFits(mechanism); });
+    }
+    catch (const std::exception& e) {
+        std::cerr << "错误: " << e.what() << std::endl;
+        return;
+    }
+
+    const size_t species = fits.size();
+    std::vector<double> temperatures(temperatureCount);
+    for (size_t t = 0; t < temperatureCount; t++) {
+        temperatures[t] = fits.minTemperature() + (fits.maxTemperature() - fits.minTemperature()) * (t + 0.5) / temperatureCount;
+    }
+
+    // 直接计算: 每次调用都按 LJ 参数求碰撞积分
+    struct Parameters {
+        double mass, diameter, wellDepth, dipole, polarizability;
+    };
+    const double debye = 1e-21 / LightSpeed;
+    std::vector<Parameters> params(species);
+    for (size_t k = 0; k < species; k++) {
+        const TransportData& transport = mechanism.transportSpecies[k];
+        params[k] = { fits.molecularWeights()[k] / Avogadro, transport.diameter * 1e-10, transport.wellDepth * Boltzmann,
+            transport.dipole * debye, transport.polarizability * 1e-30 };
+    }
+    auto reducedDipole = [](double dipole, double wellDepth, double diameter) {
+        return 0.5 * dipole * dipole / (4.0 * Pi * Epsilon0 * wellDepth * diameter * diameter * diameter);
+    };
+
+    std::vector<double> directEta(temperatureCount * species);
+    double directViscosityMs = averageMs(repeats, [&]() {
+        for (size_t t = 0; t < temperatureCount; t++) {
+            const double T = temperatures[t];
+            for (size_t k = 0; k < species; k++) {
+                const Parameters& p = params[k];
+                double om22 = collisionIntegral22(Boltzmann * T / p.wellDepth, reducedDipole(p.dipole, p.wellDepth, p.diameter));
+                directEta[t * species + k] = 5.0 / 16.0 * std::sqrt(Pi * p.mass * Boltzmann * T) / (Pi * p.diameter * p.diameter * om22);
+            }
+        }
+    });
+
+    std::vector<double> fitEta(temperatureCount * species);
+    double fitViscosityMs = averageMs(repeats, [&]() {
+        for (size_t t = 0; t < temperatureCount; t++) fits.viscosity(temperatures[t], fitEta.data() + t * species);
+    });
+
+    // 二元扩散系数只取一个温度, 物种对数为 species^2
+    const double T = temperatures[temperatureCount / 2];
+    std::vector<double> directD(species * species);
+    double directDiffusionMs = averageMs(repeats, [&]() {
+        for (size_t j = 0; j < species; j++) {
+            for (size_t k = 0; k < species; k++) {
+                const Parameters& pj = params[j];
+                const Parameters& pk = params[k];
+                double xi = 1.0;
+                if ((pj.dipole > 0.0) != (pk.dipole > 0.0)) {
+                    const Parameters& polar = pj.dipole > 0.0 ? pj : pk;
+                    const Parameters& nonpolar = pj.dipole > 0.0 ? pk : pj;
+                    double alphaStar = nonpolar.polarizability / std::pow(nonpolar.diameter, 3);
+                    double muStar = polar.dipole / std::sqrt(4.0 * Pi * Epsilon0 * std::pow(polar.diameter, 3) * polar.wellDepth);
+                    xi = 1.0 + 0.25 * alphaStar * muStar * muStar * std::sqrt(polar.wellDepth / nonpolar.wellDepth);
+                }
+                double wellDepth = xi * xi * std::sqrt(pj.wellDepth * pk.wellDepth);
+                double diameter = 0.5 * (pj.diameter + pk.diameter) * std::pow(xi, -1.0 / 6.0);
+                double om11 = collisionIntegral11(Boltzmann * T / wellDepth,
+                    reducedDipole(std::sqrt(pj.dipole * pk.dipole), wellDepth, diameter));
+                double reducedMass = pj.mass * pk.mass / (pj.mass + pk.mass);
+                directD[j * species + k] = 3.0 / 16.0 * std::sqrt(2.0 * Pi / reducedMass) * std::pow(Boltzmann * T, 1.5)
+                    / (Pi * diameter * diameter * om11) / OneAtm;
+            }
+        }
+    });
+
+    std::vector<double> fitD(species * species);
+    double fitDiffusionMs = averageMs(repeats, [&]() { fits.binaryDiffusion(T, OneAtm, fitD.data()); });
+
+    double viscosityError = 0.0;
+    for (size_t i = 0; i < directEta.size(); i++) {
+        viscosityError = std::max(viscosityError, std::fabs(fitEta[i] - directEta[i]) / directEta[i]);
+    }
+    double diffusionError = 0.0;
+    for (size_t i = 0; i < directD.size(); i++) {
+        diffusionError = std::max(diffusionError, std::fabs(fitD[i] - directD[i]) / directD[i]);
+    }
+
+    std::cout << "  " << species << " 个物种, 拟合范围 " << fits.minTemperature() << "-" << fits.maxTemperature()
+        << " K, 拟合耗时 " << buildMs << " ms" << std::endl;
+    std::cout << "  拟合点最大相对误差: 粘度 " << fits.fitError().viscosity << ", 导热系数 " << fits.fitError().conductivity
+        << ", 二元扩散 " << fits.fitError().diffusion << std::endl;
+    std::cout << "  粘度(" << temperatureCount << " 个温度): 直接计算 " << directViscosityMs << " ms, 拟合 " << fitViscosityMs << " ms";
+    if (fitViscosityMs > 0.0) std::cout << ", 加速 " << directViscosityMs / fitViscosityMs << "x";
+    std::cout << ", 最大误差 " << viscosityError << std::endl;
+    std::cout << "  二元扩散(" << species * species << " 对): 直接计算 " << directDiffusionMs << " ms, 拟合 " << fitDiffusionMs << " ms";
+    if (fitDiffusionMs > 0.0) std::cout << ", 加速 " << directDiffusionMs / fitDiffusionMs << "x";
+    std::cout << ", 最大误差 " << diffusionError << std::endl;
+}
+
+void benchmarkMixtureTransport(const std::string& yamlFile, size_t speciesLimit, size_t stateCount, int repeats) {
+    std::cout << "[基准] 混合物平均输运性质(" << ArrheniusKernel::isaName() << "): " << yamlFile << std::endl;
+
+    MechanismData mechanism = loadMechanism(yamlFile, false, false);
+    if (mechanism.transportSpecies.size() > speciesLimit) {
+        mechanism.transportSpecies.resize(speciesLimit);
+        indexSpecies(mechanism);
+    }
+
+    MixtureTransport mixture;
+    try {
+        mixture = MixtureTransport(TransportFits(mechanism));
+    }
+    catch (const std::exception& e) {
+        std::cerr << "错误: " << e.what() << std::endl;
+        return;
+    }
+    const TransportFits& fits = mixture.fits();
+    const size_t species = fits.size();
+    const auto& weights = fits.molecularWeights();
+
+    // 状态按数组结构存放: X[k * stateCount + s]
+    std::vector<double> T(stateCount), P(stateCount), X(species * stateCount);
+    for (size_t s = 0; s < stateCount; s++) {
+        T[s] = fits.minTemperature() + (fits.maxTemperature() - fits.minTemperature()) * ((s * 37) % stateCount + 0.5) / stateCount;
+        P[s] = OneAtm * (0.5 + (s % 7) * 0.25);
+        double total = 0.0;
+        for (size_t k = 0; k < species; k++) {
+            X[k * stateCount + s] = 1.0 + (k * 131 + s * 17) % 97;
+            total += X[k * stateCount + s];
+        }
+        for (size_t k = 0; k < species; k++) X[k * stateCount + s] /= total;
+    }
+
+    // 逐个状态: 取纯物种性质后按公式求和
+    std::vector<double> loopEta(stateCount), loopLambda(stateCount), loopD(species * stateCount);
+    std::vector<double> eta(species), lambda(species), binary(species * species), x(species);
+    double loopMs = averageMs(repeats, [&]() {
+        for (size_t s = 0; s < stateCount; s++) {
+            fits.viscosity(T[s], eta.data());
+            fits.conductivity(T[s], lambda.data());
+            fits.binaryDiffusion(T[s], P[s], binary.data());
+            double meanWeight = 0.0;
+            for (size_t k = 0; k < species; k++) {
+                x[k] = std::max(X[k * stateCount + s], 1e-20);
+                meanWeight += x[k] * weights[k];
+            }
+
+            double viscosity = 0.0, sum = 0.0, inverseSum = 0.0;
+            for (size_t k = 0; k < species; k++) {
+                double denominator = 0.0;
+                for (size_t j = 0; j < species; j++) {
+                    double f = 1.0 + std::sqrt(eta[k] / eta[j]) * std::pow(weights[j] / weights[k], 0.25);
+                    denominator += x[j] * f * f / std::sqrt(8.0 * (1.0 + weights[k] / weights[j]));
+                }
+                viscosity += x[k] * eta[k] / denominator;
+                sum += x[k] * lambda[k];
+                inverseSum += x[k] / lambda[k];
+
+                double diffusionSum = 0.0;
+                for (size_t j = 0; j < species; j++) {
+                    if (j != k) diffusionSum += x[j] / binary[k * species + j];
+                }
+                loopD[k * stateCount + s] = species == 1 ? binary[0]
+                    : (meanWeight - x[k] * weights[k]) / (meanWeight * diffusionSum);
+            }
+            loopEta[s] = viscosity;
+            loopLambda[s] = 0.5 * (sum + 1.0 / inverseSum);
+        }
+    });
+
+    // 逐个状态调用 MixtureTransport(每次一个状态)
+    std::vector<double> singleEta(stateCount), singleLambda(stateCount), singleD(species);
+    double singleMs = averageMs(repeats, [&]() {
+        for (size_t s = 0; s < stateCount; s++) {
+            for (size_t k = 0; k < species; k++) x[k] = X[k * stateCount + s];
+            mixture.evaluate(&T[s], &P[s], x.data(), 1, &singleEta[s], &singleLambda[s], singleD.data());
+        }
+    });
+
+    std::vector<double> batchEta(stateCount), batchLambda(stateCount), batchD(species * stateCount);
+    double batchMs = averageMs(repeats, [&]() {
+        mixture.evaluate(T.data(), P.data(), X.data(), stateCount, batchEta.data(), batchLambda.data(), batchD.data());
+    });
+    double viscosityMs = averageMs(repeats, [&]() {
+        mixture.evaluate(T.data(), P.data(), X.data(), stateCount, batchEta.data(), nullptr, nullptr);
+    });
+
+    double maxError = 0.0;
+    for (size_t s = 0; s < stateCount; s++) {
+        maxError = std::max(maxError, std::fabs(batchEta[s] - loopEta[s]) / loopEta[s]);
+        maxError = std::max(maxError, std::fabs(batchLambda[s] - loopLambda[s]) / loopLambda[s]);
+    }
+    for (size_t i = 0; i < loopD.size(); i++) {
+        maxError = std::max(maxError, std::fabs(batchD[i] - loopD[i]) / loopD[i]);
+    }
+
+    auto perState = [&](double ms) { return stateCount ? ms * 1e3 / stateCount : 0.0; };
+    std::cout << "  " << species << " 个物种, " << stateCount << " 个状态" << std::endl;
+    std::cout << "  逐个状态按公式求和: " << loopMs << " ms (" << perState(loopMs) << " us/状态)" << std::endl;
+    std::cout << "  逐个状态调用 evaluate: " << singleMs << " ms (" << perState(singleMs) << " us/状态)" << std::endl;
+    std::cout << "  批量: " << batchMs << " ms (" << perState(batchMs) << " us/状态)";
+    if (batchMs > 0.0) std::cout << ", 加速 " << loopMs / batchMs << "x / " << singleMs / batchMs << "x";
+    std::cout << ", 只算粘度 " << viscosityMs << " ms" << std::endl;
+    std::cout << "  最大相对误差: " << maxError << std::endl;
+}
+
+void benchmarkBinaryDiffusion(const std::string& yamlFile, size_t speciesLimit, size_t temperatureCount, int repeats) {
+    std::cout << "[基准] 二元扩散系数矩阵(" << ArrheniusKernel::isaName() << "): " << yamlFile << std::endl;
+
+    MechanismData mechanism = loadMechanism(yamlFile, false, false);
+    if (mechanism.transportSpecies.size() > speciesLimit) {
+        mechanism.transportSpecies.resize(speciesLimit);
+        indexSpecies(mechanism);
+    }
+
+    TransportFits fits;
+    try {
+        fits = TransportFits(mechanism);
+    }
+    catch (const std::exception& e) {
+        std::cerr << "错误: " << e.what() << std::endl;
+        return;
+    }
+
+    const size_t species = fits.size();
+    const size_t pairs = fits.pairCount();
+    constexpr size_t kCoeffs = TransportFits::kCoeffCount;
+    std::vector<double> temperatures(temperatureCount);
+    for (size_t t = 0; t < temperatureCount; t++) {
+        temperatures[t] = fits.minTemperature() + (fits.maxTemperature() - fits.minTemperature()) * (t + 0.5) / temperatureCount;
+    }
+    const double P = OneAtm;
+
+    // 原布局: 完整的 K x K 矩阵, 每个物种对的系数连续存放 [j * K + k][系数], 逐对标量 Horner
+    std::vector<double> square(species * species * kCoeffs);
+    const auto& packedCoeffs = fits.diffusionCoeffs();
+    for (size_t j = 0; j < species; j++) {
+        for (size_t k = 0; k < species; k++) {
+            const size_t pair = fits.pairIndex(j, k);
+            for (size_t c = 0; c < kCoeffs; c++) {
+                square[(j * species + k) * kCoeffs + c] = packedCoeffs[c * fits.pairStride() + pair];
+            }
+        }
+    }
+    std::vector<double> squareD(species * species);
+    double squareMs = averageMs(repeats, [&]() {
+        for (size_t t = 0; t < temperatureCount; t++) {
+            const double T = temperatures[t];
+            const double logT = std::log(T);
+            const double scale = T * std::sqrt(T) / P;
+            for (size_t i = 0; i < species * species; i++) {
+                const double* c = square.data() + i * kCoeffs;
+                double p = c[kCoeffs - 1];
+                for (size_t n = kCoeffs - 1; n-- > 0;) p = p * logT + c[n];
+                squareD[i] = p * scale;
+            }
+        }
+    });
+
+    std::vector<double> packedD(pairs);
+    double packedMs = averageMs(repeats, [&]() {
+        for (size_t t = 0; t < temperatureCount; t++) fits.binaryDiffusionPacked(temperatures[t], P, packedD.data());
+    });
+
+    std::vector<double> fullD(species * species);
+    double fullMs = averageMs(repeats, [&]() {
+        for (size_t t = 0; t < temperatureCount; t++) fits.binaryDiffusion(temperatures[t], P, fullD.data());
+    });
+
+    // 最后一个温度下比较三种结果
+    double maxError = 0.0;
+    for (size_t j = 0; j < species; j++) {
+        for (size_t k = 0; k < species; k++) {
+            const double reference = squareD[j * species + k];
+            maxError = std::max(maxError, std::fabs(fullD[j * species + k] - reference) / reference);
+            maxError = std::max(maxError, std::fabs(packedD[fits.pairIndex(j, k)] - reference) / reference);
+        }
+    }
+
+    auto megabytes = [](size_t doubles) { return doubles * sizeof(double) / 1048576.0; };
+    std::cout << "  " << species << " 个物种, " << pairs << " 个物种对, " << temperatureCount << " 个温度" << std::endl;
+    std::cout << "  系数内存: 完整矩阵 " << megabytes(square.size()) << " MB, 压缩上三角 "
+              << megabytes(packedCoeffs.size()) << " MB" << std::endl;
+    std::cout << "  完整矩阵逐对标量: " << squareMs << " ms" << std::endl;
+    std::cout << "  压缩上三角向量化: " << packedMs << " ms";
+    if (packedMs > 0.0) std::cout << ", 加速 " << squareMs / packedMs << "x";
+    std::cout << std::endl;
+    std::cout << "  压缩上三角向量化并展开为完整矩阵: " << fullMs << " ms";
+    if (fullMs > 0.0) std::cout << ", 加速 " << squareMs / fullMs << "x";
+    std::cout << std::endl;
+    std::cout << "  最大相对误差: " << maxError << std::endl;
+}
+
+void benchmarkKineticsEngine(const std::string& yamlFile, size_t stateCount, int repeats) {
+    std::cout << "[基准] 净生成速率(" << ArrheniusKernel::isaName() << "): " << yamlFile << std::endl;
+
+    MechanismData mechanism = loadMechanism(yamlFile, false, false);
+    KineticsEngine engine;
+    double buildMs = 0.0;
+    try {
+        buildMs = averageMs(1, [&]() { engine = KineticsEngine(mechanism); });
+    }
+    catch (const std::exception& e) {
+        std::cerr << "错误: " << e.what() << std::endl;
+        return;
+    }
+
+    const size_t species = engine.speciesCount();
+    const size_t reactions = engine.reactionCount();
+    const CompiledKinetics& kinetics = engine.kinetics();
+    if (reactions == 0 || stateCount == 0) {
+        std::cout << "  没有反应" << std::endl;
+        return;
+    }
+
+    // 温度 800-2500 K, 压力 1 atm 附近, 摩尔分数各不相同
+    std::vector<double> temperatures(stateCount);
+    std::vector<double> concentrations(stateCount * species);
+    for (size_t s = 0; s < stateCount; s++) {
+        const double T = 800.0 + 1700.0 * s / std::max<size_t>(stateCount - 1, 1);
+        temperatures[s] = T;
+        double total = 0.0;
+        for (size_t k = 0; k < species; k++) {
+            concentrations[s * species + k] = 1.0 + (k * 131 + s * 17) % 97;
+            total += concentrations[s * species + k];
+        }
+        const double scale = OneAtm / (GasConstant * T) / total;
+        for (size_t k = 0; k < species; k++) concentrations[s * species + k] *= scale;
+    }
+
+    // 旧式: 浓度按物种名存入 std::map, 逐反应计算
+    std::vector<LegacyReaction> legacy = legacyReactions(mechanism, kinetics);
+    std::vector<std::map<std::string, double>> namedConcentrations(stateCount);
+    for (size_t s = 0; s < stateCount; s++) {
+        for (size_t k = 0; k < species; k++) {
+            namedConcentrations[s][kinetics.speciesNames[k]] = concentrations[s * species + k];
+        }
+    }
+    std::vector<std::map<std::string, double>> legacyWdot(stateCount);
+    std::vector<double> legacyForward(stateCount * reactions), legacyReverse(stateCount * reactions);
+    std::vector<double> forward(reactions), reverse(reactions);
+    double legacyMs = averageMs(repeats, [&]() {
+        for (size_t s = 0; s < stateCount; s++) {
+            legacyProductionRates(mechanism, kinetics, legacy, temperatures[s], namedConcentrations[s],
+                legacyWdot[s], forward, reverse);
+            std::copy(forward.begin(), forward.end(), legacyForward.begin() + s * reactions);
+            std::copy(reverse.begin(), reverse.end(), legacyReverse.begin() + s * reactions);
+        }
+    });
+
+    KineticsEngine::Workspace workspace = engine.workspace();
+    std::vector<double> wdot(stateCount * species);
+    double engineMs = averageMs(repeats, [&]() {
+        for (size_t s = 0; s < stateCount; s++) {
+            engine.evaluate(temperatures[s], concentrations.data() + s * species, workspace, wdot.data() + s * species);
+        }
+    });
+
+    // 反应进度按相对误差比较; ω 各项相消时相对误差没有意义, 按该状态最大的 |ω| 归一
+    double maxRateError = 0.0;
+    double maxWdotError = 0.0;
+    auto relative = [](double a, double b) { return a == b ? 0.0 : std::fabs(a - b) / std::max(std::fabs(a), std::fabs(b)); };
+    for (size_t s = 0; s < stateCount; s++) {
+        engine.evaluate(temperatures[s], concentrations.data() + s * species, workspace, wdot.data() + s * species);
+        for (size_t r = 0; r < reactions; r++) {
+            maxRateError = std::max(maxRateError, relative(workspace.forwardRates[r], legacyForward[s * reactions + r]));
+            maxRateError = std::max(maxRateError, relative(workspace.reverseRates[r], legacyReverse[s * reactions + r]));
+        }
+        double largest = 0.0;
+        for (size_t k = 0; k < species; k++) largest = std::max(largest, std::fabs(wdot[s * species + k]));
+        for (size_t k = 0; k < species; k++) {
+            auto it = legacyWdot[s].find(kinetics.speciesNames[k]);
+            double reference = it == legacyWdot[s].end() ? 0.0 : it->second;
+            if (largest > 0.0) maxWdotError = std::max(maxWdotError, std::fabs(wdot[s * species + k] - reference) / largest);
+        }
+    }
+
+    auto perState = [&](double ms) { return ms * 1e3 / stateCount; };
+    std::cout << "  " << reactions << " 个反应, " << species << " 个物种, " << stateCount << " 个状态, 构造 "
+              << buildMs << " ms" << std::endl;
+    std::cout << "  逐反应 std::map: " << legacyMs << " ms (" << perState(legacyMs) << " us/状态)" << std::endl;
+    std::cout << "  KineticsEngine: " << engineMs << " ms (" << perState(engineMs) << " us/状态)";
+    if (engineMs > 0.0) std::cout << ", 加速 " << legacyMs / engineMs << "x";
+    std::cout << std::endl;
+    std::cout << "  最大相对误差: 反应进度 " << maxRateError << ", 净生成速率 " << maxWdotError << std::endl;
+}
+
+void benchmarkKineticsJacobian(const std::string& yamlFile, int repeats) {
+    std::cout << "[基准] 解析 Jacobian(" << ArrheniusKernel::isaName() << "): " << yamlFile << std::endl;
+
+    MechanismData mechanism = loadMechanism(yamlFile, false, false);
+    KineticsJacobian jacobian;
+    double buildMs = 0.0;
+    try {
+        KineticsEngine engine(mechanism);
+        buildMs = averageMs(1, [&]() { jacobian = KineticsJacobian(engine); });
+    }
+    catch (const std::exception& e) {
+        std::cerr << "错误: " << e.what() << std::endl;
+        return;
+    }
+
+    const KineticsEngine& engine = jacobian.engine();
+    const size_t species = jacobian.size();
+    const size_t columns = jacobian.columnCount();
+    if (engine.reactionCount() == 0) {
+        std::cout << "  没有反应" << std::endl;
+        return;
+    }
+
+    // 1500 K, 1 atm, 摩尔分数各不相同
+    const double T = 1500.0;
+    std::vector<double> concentrations(species);
+    double total = 0.0;
+    for (size_t k = 0; k < species; k++) {
+        concentrations[k] = 1.0 + (k * 131) % 97;
+        total += concentrations[k];
+    }
+    for (size_t k = 0; k < species; k++) concentrations[k] *= OneAtm / (GasConstant * T) / total;
+
+    KineticsJacobian::Workspace workspace = jacobian.workspace();
+    std::vector<double> values(jacobian.nonZeros());
+    std::vector<double> wdot(species);
+    double analyticMs = averageMs(repeats, [&]() {
+        jacobian.evaluate(T, concentrations.data(), workspace, values.data(), wdot.data());
+    });
+
+    // 单侧差分: 每列扰动一次, 共 K + 1 次 ω 计算, 结果按列写入稠密矩阵
+    KineticsEngine::Workspace& rates = workspace.kinetics;
+    std::vector<double> perturbed(concentrations), shifted(species);
+    std::vector<double> dense(species * columns);
+    auto relativeStep = [](double x) { return 1e-7 * std::max(std::fabs(x), 1e-20); };
+    double differenceMs = averageMs(repeats, [&]() {
+        engine.evaluate(T, concentrations.data(), rates, wdot.data());
+        for (size_t c = 0; c < columns; c++) {
+            const double h = c < species ? relativeStep(concentrations[c]) : 1e-7 * T;
+            if (c < species) {
+                perturbed[c] = concentrations[c] + h;
+                engine.evaluate(T, perturbed.data(), rates, shifted.data());
+                perturbed[c] = concentrations[c];
+            }
+            else {
+                engine.evaluate(T + h, concentrations.data(), rates, shifted.data());
+            }
+            for (size_t k = 0; k < species; k++) dense[k * columns + c] = (shifted[k] - wdot[k]) / h;
+        }
+    });
+
+    // 精度: 中心差分逐列比较, 误差按该列最大的 |∂ω/∂x| 归一; 同时检查稀疏结构之外的差分值.
+    // ω_k 由各反应的 q_f、q_r 相消得到, 差分的舍入误差约为 ε Σ_r |ν_rk| (q_f + q_r) / h, 此范围内的差异不计
+    jacobian.evaluate(T, concentrations.data(), workspace, values.data(), wdot.data());
+    std::vector<double> roundoff(species, 0.0);
+    const SparseMatrix& net = engine.stoichiometry().netBySpecies();
+    for (size_t k = 0; k < species; k++) {
+        for (uint32_t e = net.offsets[k]; e < net.offsets[k + 1]; e++) {
+            const uint32_t r = net.indices[e];
+            roundoff[k] += 100.0 * std::numeric_limits<double>::epsilon() * std::fabs(net.values[e])
+                * (rates.forwardRates[r] + rates.reverseRates[r]);
+        }
+    }
+    SparseMatrix analytic;
+    analytic.rows = species;
+    analytic.cols = columns;
+    analytic.offsets = jacobian.offsets();
+    analytic.indices = jacobian.indices();
+    analytic.values = values;
+    const SparseMatrix byColumn = analytic.transposed();
+    std::vector<double> plus(species), minus(species), column(species);
+    std::vector<uint8_t> inPattern(species);
+    double maxError = 0.0;
+    double maxOutside = 0.0;
+    for (size_t c = 0; c < columns; c++) {
+        const double h = c < species ? 1e-4 * std::max(concentrations[c], 1e-20) : 1e-4 * T;
+        if (c < species) {
+            perturbed[c] = concentrations[c] + h;
+            engine.evaluate(T, perturbed.data(), rates, plus.data());
+            perturbed[c] = concentrations[c] - h;
+            engine.evaluate(T, perturbed.data(), rates, minus.data());
+            perturbed[c] = concentrations[c];
+        }
+        else {
+            engine.evaluate(T + h, concentrations.data(), rates, plus.data());
+            engine.evaluate(T - h, concentrations.data(), rates, minus.data());
+        }
+        double largest = 0.0;
+        for (size_t k = 0; k < species; k++) {
+            column[k] = (plus[k] - minus[k]) / (2.0 * h);
+            largest = std::max(largest, std::fabs(column[k]));
+        }
+        if (largest == 0.0) continue;
+        std::fill(inPattern.begin(), inPattern.end(), 0);
+        for (uint32_t e = byColumn.offsets[c]; e < byColumn.offsets[c + 1]; e++) {
+            const uint32_t k = byColumn.indices[e];
+            inPattern[k] = 1;
+            maxError = std::max(maxError, std::max(std::fabs(byColumn.values[e] - column[k]) - roundoff[k] / h, 0.0) / largest);
+        }
+        for (size_t k = 0; k < species; k++) {
+            if (!inPattern[k]) maxOutside = std::max(maxOutside, std::max(std::fabs(column[k]) - roundoff[k] / h, 0.0) / largest);
+        }
+    }
+
+    std::cout << "  " << engine.reactionCount() << " 个反应, " << species << " 个物种, 非零元 " << jacobian.nonZeros()
+              << " / " << species * columns << ", 构造 " << buildMs << " ms" << std::endl;
+    std::cout << "  单侧差分(" << columns << " 次 ω): " << differenceMs << " ms" << std::endl;
+    std::cout << "  解析: " << analyticMs << " ms";
+    if (analyticMs > 0.0) std::cout << ", 加速 " << differenceMs / analyticMs << "x";
+    std::cout << std::endl;
+    std::cout << "  与中心差分的最大误差(按列归一): " << maxError << ", 稀疏结构之外: " << maxOutside << std::endl;
+}
+
+namespace {
+
+// 三个物种、四个反应, 速率和导数都有闭式解: 可逆基元反应(Δn = 0)、带效率的三体反应、
+// 分数级数的不可逆反应、Δn ≠ 0 且有活化能的可逆反应. 热力学取常比热: h/RT = a0 + a5/T, s/R = a0 ln T + a6
+const char* kClosedFormMechanism = R"(
+units: {length: m, time: s, quantity: kmol, activation-energy: J/kmol}
+species:
+- name: A
+  thermo:
+    model: NASA7
+    temperature-ranges: [200.0, 1000.0, 3500.0]
+    coefficients:
+      low: [2.5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0]
+      high: [2.5, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0]
+- name: B
+  thermo:
+    model: NASA7
+    temperature-ranges: [200.0, 1000.0, 3500.0]
+    coefficients:
+      low: [2.5, 0.0, 0.0, 0.0, 0.0, 1000.0, 0.0]
+      high: [2.5, 0.0, 0.0, 0.0, 0.0, 1000.0, 0.0]
+- name: C
+  thermo:
+    model: NASA7
+    temperature-ranges: [200.0, 1000.0, 3500.0]
+    coefficients:
+      low: [3.5, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0]
+      high: [3.5, 0.0, 0.0, 0.0, 0.0, 0.0, 1.0]
+reactions:
+- equation: A <=> B
+  rate-constant: {A: 1000.0, b: 0.0, Ea: 0.0}
+- equation: 2 A + M => C + M
+  type: three-body
+  rate-constant: {A: 50.0, b: 1.0, Ea: 0.0}
+  efficiencies: {B: 2.0}
+- equation: A + B => C
+  rate-constant: {A: 7.0, b: 0.0, Ea: 0.0}
+  orders: {A: 0.5}
+- equation: C <=> 2 A
+  rate-constant: {A: 3.0, b: 0.0, Ea: 8314.46261815324}
+)";
+
+} // namespace
+
+void checkKineticsClosedForm() {
+    std::cout << "[检查] 反应进度、净生成速率和 Jacobian 的闭式解(内置 3 物种机理)" << std::endl;
+
+    std::istringstream input(kClosedFormMechanism);
+    MechanismData mechanism = loadMechanism(YamlDocument::parse(input));
+    KineticsJacobian jacobian{ KineticsEngine(mechanism) };
+    const KineticsEngine& engine = jacobian.engine();
+
+    double maxRateError = 0.0;
+    double maxJacobianError = 0.0;
+    for (double T : { 700.0, 1200.0, 2500.0 }) {
+        const double A = 0.004, B = 0.003, C = 0.002;
+        const double c[3] = { A, B, C };
+
+        // g/RT 及其对 T 的导数
+        auto g = [T](double a0, double a5, double a6) { return a0 + a5 / T - a0 * std::log(T) - a6; };
+        auto dgdT = [T](double a0, double a5) { return -a5 / (T * T) - a0 / T; };
+        const double gA = g(2.5, 0.0, 0.0), gB = g(2.5, 1000.0, 0.0), gC = g(3.5, 0.0, 1.0);
+        const double dgA = dgdT(2.5, 0.0), dgB = dgdT(2.5, 1000.0), dgC = dgdT(3.5, 0.0);
+
+        // A <=> B
+        const double k1 = 1000.0;
+        const double Kc1 = std::exp(-(gB - gA));
+        const double dlnKc1 = -(dgB - dgA);
+        const double q1 = k1 * (A - B / Kc1);
+        // 2 A + M => C + M, [M] = A + 2B + C
+        const double k2 = 50.0 * T;
+        const double M = A + 2.0 * B + C;
+        const double q2 = k2 * M * A * A;
+        // A + B => C, A 的级数为 0.5
+        const double q3 = 7.0 * std::sqrt(A) * B;
+        // C <=> 2 A, K_c 含 (P0/RT)^Δn
+        const double EaR = 8314.46261815324 / GasConstant;
+        const double k4 = 3.0 * std::exp(-EaR / T);
+        const double Kc4 = std::exp(-(2.0 * gA - gC)) * OneAtm / (GasConstant * T);
+        const double dlnKc4 = -(2.0 * dgA - dgC) - 1.0 / T;
+        const double q4 = k4 * (C - A * A / Kc4);
+
+        // 各反应对 (A, B, C, T) 的导数
+        const double dq[4][4] = {
+            { k1, -k1 / Kc1, 0.0, k1 * B / Kc1 * dlnKc1 },
+            { k2 * (A * A + 2.0 * M * A), 2.0 * k2 * A * A, k2 * A * A, 50.0 * M * A * A },
+            { 3.5 * B / std::sqrt(A), 7.0 * std::sqrt(A), 0.0, 0.0 },
+            { -2.0 * k4 * A / Kc4, 0.0, k4, k4 * EaR / (T * T) * (C - A * A / Kc4) + k4 * A * A / Kc4 * dlnKc4 },
+        };
+        const double nu[3][4] = { { -1.0, -2.0, -1.0, 2.0 }, { 1.0, 0.0, -1.0, 0.0 }, { 0.0, 1.0, 1.0, -1.0 } };
+        const double q[4] = { q1, q2, q3, q4 };
+
+        KineticsJacobian::Workspace workspace = jacobian.workspace();
+        std::vector<double> values(jacobian.nonZeros());
+        double wdot[3];
+        jacobian.evaluate(T, c, workspace, values.data(), wdot);
+        std::vector<double> dense(3 * 4, 0.0);
+        for (size_t k = 0; k < 3; k++) {
+            for (uint32_t e = jacobian.offsets()[k]; e < jacobian.offsets()[k + 1]; e++) {
+                dense[k * 4 + jacobian.indices()[e]] = values[e];
+            }
+        }
+
+        auto fail = [T](const std::string& what, double value, double expected) {
+            std::ostringstream message;
+            message.precision(12);
+            message << "闭式解检查失败(T = " << T << " K): " << what << " = " << value << ", 应为 " << expected;
+            throw std::runtime_error(message.str());
+        };
+        for (size_t r = 0; r < 4; r++) {
+            const double error = std::fabs(workspace.kinetics.netRates[r] - q[r]) / std::fabs(q[r]);
+            if (!(error < 1e-10)) fail("反应 " + std::to_string(r) + " 的反应进度", workspace.kinetics.netRates[r], q[r]);
+            maxRateError = std::max(maxRateError, error);
+        }
+        for (size_t k = 0; k < 3; k++) {
+            double expected = 0.0, scale = 0.0;
+            for (size_t r = 0; r < 4; r++) {
+                expected += nu[k][r] * q[r];
+                scale += std::fabs(nu[k][r] * q[r]);
+            }
+            const double error = std::fabs(wdot[k] - expected) / scale;
+            if (!(error < 1e-10)) fail("物种 " + std::to_string(k) + " 的净生成速率", wdot[k], expected);
+            maxRateError = std::max(maxRateError, error);
+        }
+        // 稀疏结构之外的元素按0比较; 误差按该元素各反应贡献的绝对值之和归一
+        for (size_t k = 0; k < 3; k++) {
+            for (size_t j = 0; j < 4; j++) {
+                double expected = 0.0, scale = 0.0;
+                for (size_t r = 0; r < 4; r++) {
+                    expected += nu[k][r] * dq[r][j];
+                    scale += std::fabs(nu[k][r] * dq[r][j]);
+                }
+                const double error = std::fabs(dense[k * 4 + j] - expected) / std::max(scale, 1e-300);
+                if (!(error < 1e-10)) {
+                    fail("∂ω_" + std::to_string(k) + "/∂" + (j < 3 ? "C_" + std::to_string(j) : std::string("T")),
+                        dense[k * 4 + j], expected);
+                }
+                maxJacobianError = std::max(maxJacobianError, error);
+            }
+        }
+    }
+    std::cout << "  " << engine.reactionCount() << " 个反应, 700/1200/2500 K: 反应进度和 ω 的最大相对误差 " << maxRateError
+              << ", Jacobian " << maxJacobianError << std::endl;
+}
+
+void runBenchmarks(const std::string& yamlFile, int repeats) {
+    checkKineticsClosedForm();
+    benchmarkLoadMechanism(yamlFile, repeats);
+    benchmarkStreamingLoad(yamlFile, repeats);
+    benchmarkYamlValueMemory(yamlFile);
+    benchmarkArenaDocument(yamlFile, repeats);
+    benchmarkExtraction(yamlFile, repeats);
+    benchmarkScalarParse(yamlFile, repeats);
+    benchmarkLazyLoad(yamlFile, 300, repeats);
+    benchmarkMechanismCache(yamlFile, repeats);
+    benchmarkCompiledMechanism(yamlFile, repeats);
+    benchmarkParallelThermo(yamlFile, repeats);
+    benchmarkBatchLoad(yamlFile, 16, repeats);
+    benchmarkCompileKinetics(yamlFile, repeats);
+    benchmarkArrheniusKernel(yamlFile, 64, repeats);
+    benchmarkFalloffKernel(yamlFile, 64, repeats);
+    benchmarkThirdBodyMatrix(yamlFile, 256, repeats);
+    benchmarkNasa7Thermo(yamlFile, 64, repeats);
+    benchmarkNasa9Thermo(yamlFile, 64, repeats);
+    benchmarkStoichiometricMatrix(yamlFile, repeats);
+    benchmarkEquationTokenizer(yamlFile, repeats);
+    benchmarkSpeciesTable(yamlFile, repeats);
+    benchmarkTransportFits(yamlFile, 100, 64, repeats);
+    benchmarkBinaryDiffusion(yamlFile, 500, 16, repeats);
+    benchmarkMixtureTransport(yamlFile, 100, 1024, repeats);
+    benchmarkKineticsEngine(yamlFile, 16, repeats);
+    benchmarkKineticsJacobian(yamlFile, repeats);
+}
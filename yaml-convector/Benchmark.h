@@ -0,0 +1,94 @@
+#pragma once
+#include <cstddef>
+#include <string>
+
+// ========== 性能基准测试 ==========
+// 各函数将计时结果打印到标准输出, repeats 为重复次数(取平均值)
+
+// 对比: 三个提取函数各自读取解析文件 vs loadMechanism 只解析一次
+void benchmarkLoadMechanism(const std::string& yamlFile, int repeats = 3);
+
+// 对比: loadMechanism(完整文档树) vs loadMechanismStreaming(逐条记录)
+void benchmarkStreamingLoad(const std::string& yamlFile, int repeats = 3);
+
+// 统计 YamlValue 树的内存占用: 当前标签联合布局 vs 旧的"所有成员并存"布局(每节点字节数)
+void benchmarkYamlValueMemory(const std::string& yamlFile);
+
+// 对比: YamlValue 树 vs 扁平化 YamlDocument 的解析、提取和释放耗时
+void benchmarkArenaDocument(const std::string& yamlFile, int repeats = 3);
+
+// 提取耗时(不含解析): 在已解析的 YamlValue 树和 YamlDocument 上运行 extractKinetics/extractThermo
+void benchmarkExtraction(const std::string& yamlFile, int repeats = 3);
+
+// 标量解析耗时: 单独的标量类型推断(fromScalar) 以及 YamlValue 树/YamlDocument 的完整解析
+void benchmarkScalarParse(const std::string& yamlFile, int repeats = 3);
+
+// 选择性读取(前 selectCount 个物种的热力学数据): 完整转换的 YamlValue 树 vs 延迟转换
+void benchmarkLazyLoad(const std::string& yamlFile, size_t selectCount = 300, int repeats = 3);
+
+// 对比: loadMechanism 解析YAML vs 读取二进制缓存(会在源文件旁生成缓存文件)
+void benchmarkMechanismCache(const std::string& yamlFile, int repeats = 3);
+
+// 对比: 二进制缓存反序列化为 MechanismData vs 直接映射编译后的机理文件
+void benchmarkCompiledMechanism(const std::string& yamlFile, int repeats = 3);
+
+// 对比: 串行 extractThermo vs extractThermoParallel(1, 2, 4, ... 直到硬件线程数)
+void benchmarkParallelThermo(const std::string& yamlFile, int repeats = 3);
+
+// 批量加载吞吐量(文件/秒): 逐个 loadMechanismFile vs loadMechanisms(1, 2, 4, ... 直到硬件线程数)
+// 同一文件重复 fileCount 次, 不使用缓存
+void benchmarkBatchLoad(const std::string& yamlFile, size_t fileCount = 16, int repeats = 3);
+
+// 动力学数据编译耗时, 以及同一温度下计算全部反应速率常数: ReactionData 逐条读取 vs 编译后的连续数组
+void benchmarkCompileKinetics(const std::string& yamlFile, int repeats = 3);
+
+// 全部反应的 Arrhenius 速率常数: 逐个反应计算 A*T^b*exp(-Ea/RT) vs ArrheniusKernel, 单个温度和 temperatureCount 个温度
+void benchmarkArrheniusKernel(const std::string& yamlFile, size_t temperatureCount = 64, int repeats = 3);
+
+// 全部衰减反应的速率常数(Lindemann/Troe): 逐个反应按公式计算 vs FalloffKernel, stateCount 个(T, [M])状态;
+// 并检查 ThirdBodyMatrix 批量 [M] 直接输入批量 FalloffKernel 的结果
+void benchmarkFalloffKernel(const std::string& yamlFile, size_t stateCount = 64, int repeats = 3);
+
+// 全部三体/衰减反应的 [M]: 按物种名遍历 efficiencies vs 稀疏矩阵(逐个状态和批量), stateCount 个状态
+void benchmarkThirdBodyMatrix(const std::string& yamlFile, size_t stateCount = 256, int repeats = 3);
+
+// 全部 NASA7 物种的 cp/R、h/RT、s/R、g/RT: 逐个物种读取 ThermoData vs Nasa7Thermo, temperatureCount 个温度
+void benchmarkNasa7Thermo(const std::string& yamlFile, size_t temperatureCount = 64, int repeats = 3);
+
+// 全部 NASA9 物种的 cp/R、h/RT、s/R、g/RT: 逐个物种线性查找温区 vs Nasa9Thermo, temperatureCount 个温度
+void benchmarkNasa9Thermo(const std::string& yamlFile, size_t temperatureCount = 64, int repeats = 3);
+
+// 化学计量矩阵编译耗时, 以及物种生成速率: 每次调用 parseReactionEquation vs 稀疏矩阵
+void benchmarkStoichiometricMatrix(const std::string& yamlFile, int repeats = 3);
+
+// 全部反应方程的分词: 旧版 stringstream 解析(每个词分配字符串) vs tokenizeEquation(string_view, 复用 terms)
+void benchmarkEquationTokenizer(const std::string& yamlFile, int repeats = 3);
+
+// 物种表建表耗时, 以及机理中全部物种引用的查找: unordered_map<std::string>(先构造字符串) vs SpeciesTable
+void benchmarkSpeciesTable(const std::string& yamlFile, int repeats = 3);
+
+// 纯物种输运性质拟合耗时和误差, 以及粘度(temperatureCount 个温度)和二元扩散系数:
+// 每次按 LJ 参数计算碰撞积分 vs TransportFits. 只取前 speciesLimit 个有输运数据的物种
+void benchmarkTransportFits(const std::string& yamlFile, size_t speciesLimit = 100, size_t temperatureCount = 64, int repeats = 3);
+
+// 二元扩散系数矩阵, temperatureCount 个温度: 完整 K x K 矩阵逐对标量计算 vs 压缩上三角向量化计算
+// (只输出上三角、展开为完整矩阵). 只取前 speciesLimit 个有输运数据的物种
+void benchmarkBinaryDiffusion(const std::string& yamlFile, size_t speciesLimit = 500, size_t temperatureCount = 16, int repeats = 3);
+
+// 混合物粘度、导热系数和混合物平均扩散系数, stateCount 个 (T, P, X) 状态:
+// 逐个状态取纯物种性质后求和、逐个状态调用 MixtureTransport vs 批量计算. 只取前 speciesLimit 个有输运数据的物种
+void benchmarkMixtureTransport(const std::string& yamlFile, size_t speciesLimit = 100, size_t stateCount = 1024, int repeats = 3);
+
+// 反应进度和净生成速率, stateCount 个 (T, C) 状态: 逐反应按物种名查 std::map 计算 vs KineticsEngine
+void benchmarkKineticsEngine(const std::string& yamlFile, size_t stateCount = 16, int repeats = 3);
+
+// 净生成速率对浓度和温度的 Jacobian: 单侧差分(K + 1 次 KineticsEngine) vs KineticsJacobian,
+// 并与中心差分逐列比较精度
+void benchmarkKineticsJacobian(const std::string& yamlFile, int repeats = 3);
+
+// 内置的 3 物种、4 个反应的机理上, KineticsEngine 和 KineticsJacobian 与闭式解逐项比较(含稀疏结构之外的元素),
+// 不一致时抛出 std::runtime_error. runBenchmarks 最先调用, 不依赖机理文件
+void checkKineticsClosedForm();
+
+// 运行全部基准测试
+void runBenchmarks(const std::string& yamlFile, int repeats = 3);
@@ -0,0 +1,191 @@
+#include "CompiledKinetics.h"
+#include "EquationTokenizer.h"
+#include "UnitConversion.h"
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+
+uint32_t speciesIndexOf(const SpeciesTable& species, std::string_view name, size_t i) {
+    uint32_t index = species.find(name);
+    if (index == SpeciesTable::npos) {
+        throw std::runtime_error("反应 " + std::to_string(i) + ": 未知物种 '" + std::string(name) + "'");
+    }
+    return index;
+}
+
+ReactionType reactionTypeOf(const ReactionData& reaction, size_t i) {
+    const std::string& type = reaction.type;
+    if (type.empty() || type == "elementary") return ReactionType::Elementary;
+    if (type == "three-body") return ReactionType::ThreeBody;
+    if (type == "falloff") {
+        // 只实现 Lindemann 和 Troe; SRI/Tsang 按 Lindemann 计算会得到错误的速率常数
+        if (!reaction.falloffForm.empty() && reaction.falloffForm != "Troe") {
+            throw std::runtime_error("反应 " + std::to_string(i) + ": 不支持的衰减形式 '" + reaction.falloffForm + "'");
+        }
+        if (reaction.falloffForm.empty()) return ReactionType::Lindemann;
+        // 有 Troe 参数块但 a、T***、T* 都没有提取到(如写成 A/T3/T1/T2)时, 按 Lindemann 计算同样是错误的速率常数
+        const auto& troe = reaction.troe;
+        if (troe.a == 0.0 && troe.T_triple_star == 0.0 && troe.T_star == 0.0) {
+            throw std::runtime_error("反应 " + std::to_string(i) + ": Troe 参数缺少 a、T***、T*");
+        }
+        return ReactionType::Troe;
+    }
+    throw std::runtime_error("反应 " + std::to_string(i) + ": 不支持的反应类型 '" + type + "'");
+}
+
+// 反应物的总级数: 方程中的化学计量数之和, orders 中给出的物种以其为准
+double reactionOrder(const ReactionData& reaction, const std::vector<EquationTerm>& terms, size_t reactantCount) {
+    double order = 0.0;
+    for (size_t t = 0; t < reactantCount; t++) {
+        if (reaction.orders.find(std::string(terms[t].species)) == reaction.orders.end()) {
+            order += terms[t].stoich;
+        }
+    }
+    for (const auto& [name, value] : reaction.orders) {
+        order += value;
+    }
+    return order;
+}
+
+// 指前因子换算系数: A 的单位为 (浓度)^(1-n)/时间
+double preExponentialFactor(double order, double concentrationFactor, double timeFactor) {
+    return std::pow(concentrationFactor, 1.0 - order) / timeFactor;
+}
+
+} // namespace
+
+CompiledKinetics compileKinetics(const std::vector<ReactionData>& reactions,
+    const SpeciesTable& species, const UnitSystem& units) {
+    species.requireUnique();
+    CompiledKinetics kinetics;
+    kinetics.speciesCount = species.size();
+    kinetics.speciesNames = species.names();
+
+    // 默认单位: 浓度 quantity/length^3, 时间 time, 活化能 activation-energy
+    double lengthFactor = unitFactor(units.length);
+    double concentrationFactor = unitFactor(units.quantity) / (lengthFactor * lengthFactor * lengthFactor);
+    double timeFactor = unitFactor(units.time);
+    double defaultEaFactor = activationEnergyFactor(units.activationEnergy);
+
+    const size_t count = reactions.size();
+    kinetics.A.resize(count);
+    kinetics.b.resize(count);
+    kinetics.Ea.resize(count);
+    kinetics.type.resize(count);
+    kinetics.defaultEfficiency.resize(count);
+    kinetics.efficiencyOffsets.reserve(count + 1);
+    kinetics.orderOffsets.reserve(count + 1);
+    kinetics.efficiencyOffsets.push_back(0);
+    kinetics.orderOffsets.push_back(0);
+
+    // 衰减反应先按类型收集, 最后 Troe 在前拼接
+    std::vector<uint32_t> troeReactions;
+    std::vector<uint32_t> lindemannReactions;
+    std::vector<double> lowEaFactor(count, defaultEaFactor);
+    std::vector<double> lowAFactor(count, 1.0);
+
+    std::vector<EquationTerm> terms;
+
+    for (size_t i = 0; i < count; i++) {
+        const ReactionData& reaction = reactions[i];
+        ReactionType type = reactionTypeOf(reaction, i);
+        kinetics.type[i] = type;
+
+        ParsedEquation parsed;
+        try {
+            parsed = tokenizeEquation(reaction.equation, terms);
+        }
+        catch (const std::exception& e) {
+            throw std::runtime_error("反应 " + std::to_string(i) + ": " + e.what());
+        }
+        for (const auto& term : terms) {
+            speciesIndexOf(species, term.species, i);
+        }
+
+        double order = reactionOrder(reaction, terms, parsed.reactantCount);
+        bool thirdBody = type != ReactionType::Elementary;
+        if (type == ReactionType::ThreeBody) order += 1.0;
+
+        double aFactor = reaction.rateConstant.A_units.empty()
+            ? preExponentialFactor(order, concentrationFactor, timeFactor)
+            : unitFactor(reaction.rateConstant.A_units);
+        double eaFactor = reaction.rateConstant.Ea_units.empty()
+            ? defaultEaFactor
+            : activationEnergyFactor(reaction.rateConstant.Ea_units);
+
+        kinetics.A[i] = reaction.rateConstant.A * aFactor;
+        kinetics.b[i] = reaction.rateConstant.b;
+        kinetics.Ea[i] = reaction.rateConstant.Ea * eaFactor;
+
+        // 第三体效率
+        if (thirdBody && parsed.thirdBody == ThirdBodyMarker::Falloff && parsed.collider != "M") {
+            kinetics.defaultEfficiency[i] = 0.0;
+            kinetics.efficiencySpecies.push_back(speciesIndexOf(species, parsed.collider, i));
+            kinetics.efficiencyValues.push_back(1.0);
+        }
+        else {
+            kinetics.defaultEfficiency[i] = thirdBody ? 1.0 : 0.0;
+            if (thirdBody) {
+                for (const auto& [name, value] : reaction.efficiencies) {
+                    kinetics.efficiencySpecies.push_back(speciesIndexOf(species, name, i));
+                    kinetics.efficiencyValues.push_back(value);
+                }
+            }
+        }
+        kinetics.efficiencyOffsets.push_back(static_cast<uint32_t>(kinetics.efficiencySpecies.size()));
+
+        for (const auto& [name, value] : reaction.orders) {
+            kinetics.orderSpecies.push_back(speciesIndexOf(species, name, i));
+            kinetics.orderValues.push_back(value);
+        }
+        kinetics.orderOffsets.push_back(static_cast<uint32_t>(kinetics.orderSpecies.size()));
+
+        if (type == ReactionType::Troe || type == ReactionType::Lindemann) {
+            // 低压限多一个第三体浓度
+            lowAFactor[i] = preExponentialFactor(order + 1.0, concentrationFactor, timeFactor);
+            lowEaFactor[i] = eaFactor;
+            (type == ReactionType::Troe ? troeReactions : lindemannReactions).push_back(static_cast<uint32_t>(i));
+        }
+    }
+
+    FalloffBlock& falloff = kinetics.falloff;
+    falloff.troeCount = troeReactions.size();
+    falloff.reaction = std::move(troeReactions);
+    falloff.reaction.insert(falloff.reaction.end(), lindemannReactions.begin(), lindemannReactions.end());
+
+    const size_t falloffCount = falloff.reaction.size();
+    falloff.lowA.resize(falloffCount);
+    falloff.lowB.resize(falloffCount);
+    falloff.lowEa.resize(falloffCount);
+    falloff.troeA.resize(falloff.troeCount);
+    falloff.troeT3.resize(falloff.troeCount);
+    falloff.troeT1.resize(falloff.troeCount);
+    falloff.troeT2.resize(falloff.troeCount);
+
+    for (size_t j = 0; j < falloffCount; j++) {
+        size_t i = falloff.reaction[j];
+        const ReactionData& reaction = reactions[i];
+        falloff.lowA[j] = reaction.lowPressure.A * lowAFactor[i];
+        falloff.lowB[j] = reaction.lowPressure.b;
+        falloff.lowEa[j] = reaction.lowPressure.Ea * lowEaFactor[i];
+
+        if (j < falloff.troeCount) {
+            falloff.troeA[j] = reaction.troe.a;
+            falloff.troeT3[j] = reaction.troe.T_triple_star;
+            falloff.troeT1[j] = reaction.troe.T_star;
+            falloff.troeT2[j] = reaction.troe.T_double_star;
+        }
+    }
+
+    return kinetics;
+}
+
+CompiledKinetics compileKinetics(const std::vector<ReactionData>& reactions,
+    const std::vector<std::string>& speciesNames, const UnitSystem& units) {
+    return compileKinetics(reactions, SpeciesTable(speciesNames), units);
+}
+
+CompiledKinetics compileKinetics(const MechanismData& mechanism) {
+    return compileKinetics(mechanism.reactions, mechanism.species, mechanism.units);
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Mechanism.h"
+
+// ========== 编译后的动力学数据(数组结构) ==========
+// 由 ReactionData 生成, 供速率计算核心使用:
+//   - 所有数值换算为SI单位(m, s, kmol, J/kmol), 指前因子按反应级数换算
+//   - 每个反应的参数按字段存放在连续数组中, 下标即反应在 reactions 中的下标
+//   - 衰减反应的低压限和 Troe 参数只为衰减反应存放, 通过 falloff.reaction 映射回反应下标
+//   - 第三体效率和反应级数以物种下标为列的CSR存放
+
+// 反应类型
+enum class ReactionType : uint8_t {
+    Elementary,     // 基元反应
+    ThreeBody,      // 三体反应
+    Lindemann,      // 衰减反应(无衰减函数参数块)
+    Troe            // Troe 衰减反应
+};
+
+// 衰减反应块: Troe 反应排在前面, 之后是 Lindemann 反应
+struct FalloffBlock {
+    std::vector<uint32_t> reaction;     // 在反应数组中的下标
+    std::vector<double> lowA;           // 低压限, SI单位
+    std::vector<double> lowB;
+    std::vector<double> lowEa;          // J/kmol
+
+    // Troe 参数, 只有前 troeCount 项: Fcent = (1-a)exp(-T/T3) + a*exp(-T/T1) + exp(-T2/T)
+    size_t troeCount = 0;
+    std::vector<double> troeA;
+    std::vector<double> troeT3;         // T***
+    std::vector<double> troeT1;         // T*
+    std::vector<double> troeT2;         // T**, 为0时不含第三项
+
+    size_t size() const { return reaction.size(); }
+};
+
+struct CompiledKinetics {
+    size_t speciesCount = 0;
+    std::vector<std::string> speciesNames;
+
+    // 每个反应一项: 普通反应的速率常数, 衰减反应的高压限
+    std::vector<double> A;              // SI单位
+    std::vector<double> b;
+    std::vector<double> Ea;             // J/kmol
+    std::vector<ReactionType> type;
+
+    FalloffBlock falloff;
+
+    // 第三体效率: 每个反应一行, 未列出的物种效率为 defaultEfficiency.
+    // 三体/衰减反应的默认值为1, 指定碰撞体(如 "(+AR)")时默认值为0、该物种效率为1; 基元反应为0且无条目
+    std::vector<double> defaultEfficiency;
+    std::vector<uint32_t> efficiencyOffsets;    // [反应数 + 1]
+    std::vector<uint32_t> efficiencySpecies;    // 物种下标
+    std::vector<double> efficiencyValues;
+
+    // 显式给出的反应级数(orders 字段)
+    std::vector<uint32_t> orderOffsets;         // [反应数 + 1]
+    std::vector<uint32_t> orderSpecies;
+    std::vector<double> orderValues;
+
+    size_t reactionCount() const { return A.size(); }
+};
+
+// 编译动力学数据, species 给出物种下标; species 中有重复名称(见 SpeciesTable::duplicates)时,
+// 或出现未知物种、不支持的反应类型、衰减形式(SRI, Tsang)、缺少参数的 Troe 块或单位时
+// 抛出 std::runtime_error(信息中包含反应下标)
+CompiledKinetics compileKinetics(const std::vector<ReactionData>& reactions,
+    const SpeciesTable& species, const UnitSystem& units = UnitSystem());
+// 物种下标为 speciesNames 中的位置(名称不能重复)
+CompiledKinetics compileKinetics(const std::vector<ReactionData>& reactions,
+    const std::vector<std::string>& speciesNames, const UnitSystem& units = UnitSystem());
+// 物种下标取 mechanism.species
+CompiledKinetics compileKinetics(const MechanismData& mechanism);
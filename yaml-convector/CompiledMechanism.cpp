@@ -0,0 +1,583 @@
+#include "CompiledMechanism.h"
+#include "AtomicFile.h"
+#include <cstring>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+const char kCompiledMagic[8] = { 'Y', 'C', 'M', 'E', 'C', 'H', 'M', 'M' };
+constexpr uint32_t kByteOrderMark = 0x01020304;
+constexpr size_t kSectionCount = static_cast<size_t>(CompiledSection::Count);
+constexpr size_t kAlignment = 8;
+
+// 文件头, 紧接着是段表 SectionEntry[kSectionCount]
+struct CompiledHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    uint64_t sourceHash;
+    uint32_t reactionCount;
+    uint32_t thermoCount;
+    uint32_t transportCount;
+    uint32_t sectionCount;
+};
+
+static_assert(sizeof(CompiledHeader) == 40, "CompiledHeader layout changed");
+static_assert(sizeof(CompiledMechanism::SectionEntry) == 16, "SectionEntry layout changed");
+
+uint32_t toIndex(size_t n) {
+    if (n > UINT32_MAX) {
+        throw std::runtime_error("mechanism too large for compiled file");
+    }
+    return static_cast<uint32_t>(n);
+}
+
+// 编译过程中各段的内容
+class SectionBuilder {
+public:
+    SectionBuilder() {
+        // 字符串编号0为空字符串
+        m_sections[index(CompiledSection::StringOffsets)].resize(sizeof(uint32_t));
+        intern(std::string());
+    }
+
+    template <typename T>
+    void push(CompiledSection section, const T& value) {
+        auto& bytes = m_sections[index(section)];
+        const char* p = reinterpret_cast<const char*>(&value);
+        bytes.insert(bytes.end(), p, p + sizeof(T));
+    }
+
+    void pushString(CompiledSection section, const std::string& value) {
+        push(section, intern(value));
+    }
+
+    // 追加一行CSR数据: 值写入 values 段, 行尾下标写入 offsets 段
+    void pushRow(CompiledSection offsets, CompiledSection values, const std::vector<double>& row) {
+        for (double v : row) push(values, v);
+        push(offsets, toIndex(count<double>(values)));
+    }
+
+    void pushNamedRow(CompiledSection offsets, CompiledSection names, CompiledSection values,
+        const std::map<std::string, double>& row) {
+        for (const auto& [name, v] : row) {
+            pushString(names, name);
+            push(values, v);
+        }
+        push(offsets, toIndex(count<double>(values)));
+    }
+
+    // CSR offsets 段的起始 0
+    void beginRows(CompiledSection offsets) { push(offsets, uint32_t(0)); }
+
+    template <typename T>
+    size_t count(CompiledSection section) const { return m_sections[index(section)].size() / sizeof(T); }
+
+    const std::vector<char>& bytes(size_t i) const { return m_sections[i]; }
+
+private:
+    static size_t index(CompiledSection section) { return static_cast<size_t>(section); }
+
+    uint32_t intern(const std::string& value) {
+        auto it = m_stringIds.find(value);
+        if (it != m_stringIds.end()) return it->second;
+
+        uint32_t id = toIndex(m_stringIds.size());
+        auto& bytes = m_sections[index(CompiledSection::StringBytes)];
+        bytes.insert(bytes.end(), value.begin(), value.end());
+        push(CompiledSection::StringOffsets, toIndex(bytes.size()));
+        m_stringIds.emplace(value, id);
+        return id;
+    }
+
+    std::vector<char> m_sections[kSectionCount];
+    std::unordered_map<std::string, uint32_t> m_stringIds;
+};
+
+void buildReactions(SectionBuilder& out, const std::vector<ReactionData>& reactions) {
+    out.beginRows(CompiledSection::EfficiencyOffsets);
+    out.beginRows(CompiledSection::OrderOffsets);
+    for (const auto& reaction : reactions) {
+        out.pushString(CompiledSection::ReactionEquation, reaction.equation);
+        out.pushString(CompiledSection::ReactionType, reaction.type);
+        out.pushString(CompiledSection::ReactionAUnits, reaction.rateConstant.A_units);
+        out.pushString(CompiledSection::ReactionEaUnits, reaction.rateConstant.Ea_units);
+        out.pushString(CompiledSection::ReactionFalloffForm, reaction.falloffForm);
+        out.push(CompiledSection::ReactionFlags, uint32_t(reaction.isDuplicate ? 1 : 0));
+        out.push(CompiledSection::RateA, reaction.rateConstant.A);
+        out.push(CompiledSection::RateB, reaction.rateConstant.b);
+        out.push(CompiledSection::RateEa, reaction.rateConstant.Ea);
+        out.push(CompiledSection::LowA, reaction.lowPressure.A);
+        out.push(CompiledSection::LowB, reaction.lowPressure.b);
+        out.push(CompiledSection::LowEa, reaction.lowPressure.Ea);
+        out.push(CompiledSection::TroeA, reaction.troe.a);
+        out.push(CompiledSection::TroeT3, reaction.troe.T_triple_star);
+        out.push(CompiledSection::TroeT1, reaction.troe.T_star);
+        out.push(CompiledSection::TroeT2, reaction.troe.T_double_star);
+        out.pushNamedRow(CompiledSection::EfficiencyOffsets, CompiledSection::EfficiencySpecies,
+            CompiledSection::EfficiencyValues, reaction.efficiencies);
+        out.pushNamedRow(CompiledSection::OrderOffsets, CompiledSection::OrderSpecies,
+            CompiledSection::OrderValues, reaction.orders);
+    }
+}
+
+void buildThermo(SectionBuilder& out, const std::vector<ThermoData>& thermoSpecies) {
+    out.beginRows(CompiledSection::CompositionOffsets);
+    out.beginRows(CompiledSection::TemperatureRangeOffsets);
+    out.beginRows(CompiledSection::Nasa7LowOffsets);
+    out.beginRows(CompiledSection::Nasa7HighOffsets);
+    out.beginRows(CompiledSection::Nasa9RangeOffsets);
+    out.beginRows(CompiledSection::Nasa9TRangeOffsets);
+    out.beginRows(CompiledSection::Nasa9CoeffOffsets);
+
+    uint32_t nasa9Ranges = 0;
+    for (const auto& thermo : thermoSpecies) {
+        out.pushString(CompiledSection::ThermoName, thermo.name);
+        out.pushString(CompiledSection::ThermoModel, thermo.model);
+        out.pushNamedRow(CompiledSection::CompositionOffsets, CompiledSection::CompositionElement,
+            CompiledSection::CompositionValues, thermo.composition);
+        out.pushRow(CompiledSection::TemperatureRangeOffsets, CompiledSection::TemperatureRangeValues,
+            thermo.temperatureRanges);
+        out.pushRow(CompiledSection::Nasa7LowOffsets, CompiledSection::Nasa7LowValues, thermo.coefficients.low);
+        out.pushRow(CompiledSection::Nasa7HighOffsets, CompiledSection::Nasa7HighValues, thermo.coefficients.high);
+
+        for (const auto& range : thermo.nasa9Coeffs) {
+            out.pushRow(CompiledSection::Nasa9TRangeOffsets, CompiledSection::Nasa9TRangeValues,
+                range.temperatureRange);
+            out.pushRow(CompiledSection::Nasa9CoeffOffsets, CompiledSection::Nasa9CoeffValues,
+                range.coefficients);
+        }
+        nasa9Ranges = toIndex(nasa9Ranges + thermo.nasa9Coeffs.size());
+        out.push(CompiledSection::Nasa9RangeOffsets, nasa9Ranges);
+    }
+}
+
+void buildTransport(SectionBuilder& out, const std::vector<TransportData>& transportSpecies) {
+    for (const auto& transport : transportSpecies) {
+        out.pushString(CompiledSection::TransportName, transport.name);
+        out.pushString(CompiledSection::TransportModel, transport.model);
+        out.pushString(CompiledSection::TransportGeometry, transport.geometry);
+        out.pushString(CompiledSection::TransportNote, transport.note);
+        out.push(CompiledSection::TransportDiameter, transport.diameter);
+        out.push(CompiledSection::TransportWellDepth, transport.wellDepth);
+        out.push(CompiledSection::TransportDipole, transport.dipole);
+        out.push(CompiledSection::TransportPolarizability, transport.polarizability);
+        out.push(CompiledSection::TransportRotationalRelaxation, transport.rotationalRelaxation);
+    }
+}
+
+size_t alignUp(size_t n) {
+    return (n + kAlignment - 1) / kAlignment * kAlignment;
+}
+
+} // namespace
+
+void compileMechanism(const MechanismData& mechanism, const std::string& outFile, uint64_t sourceHash) {
+    SectionBuilder builder;
+    builder.pushString(CompiledSection::Units, mechanism.units.length);
+    builder.pushString(CompiledSection::Units, mechanism.units.time);
+    builder.pushString(CompiledSection::Units, mechanism.units.quantity);
+    builder.pushString(CompiledSection::Units, mechanism.units.activationEnergy);
+    buildReactions(builder, mechanism.reactions);
+    buildThermo(builder, mechanism.thermoSpecies);
+    buildTransport(builder, mechanism.transportSpecies);
+
+    CompiledHeader header = {};
+    std::memcpy(header.magic, kCompiledMagic, sizeof(header.magic));
+    header.version = kCompiledMechanismVersion;
+    header.byteOrder = kByteOrderMark;
+    header.sourceHash = sourceHash;
+    header.reactionCount = toIndex(mechanism.reactions.size());
+    header.thermoCount = toIndex(mechanism.thermoSpecies.size());
+    header.transportCount = toIndex(mechanism.transportSpecies.size());
+    header.sectionCount = static_cast<uint32_t>(kSectionCount);
+
+    CompiledMechanism::SectionEntry sections[kSectionCount] = {};
+    size_t offset = alignUp(sizeof(header) + sizeof(sections));
+    for (size_t i = 0; i < kSectionCount; i++) {
+        sections[i].offset = offset;
+        sections[i].size = builder.bytes(i).size();
+        offset = alignUp(offset + sections[i].size);
+    }
+
+    std::vector<char> image(offset, '\0');
+    std::memcpy(image.data(), &header, sizeof(header));
+    std::memcpy(image.data() + sizeof(header), sections, sizeof(sections));
+    for (size_t i = 0; i < kSectionCount; i++) {
+        const auto& bytes = builder.bytes(i);
+        if (!bytes.empty()) {
+            std::memcpy(image.data() + sections[i].offset, bytes.data(), bytes.size());
+        }
+    }
+
+    // 先写唯一命名的临时文件再原子替换(见 AtomicFile.h): 已映射旧文件的进程不受影响,
+    // 同时编译同一机理的多个进程不会写坏输出, 读者也不会找不到文件
+    if (!writeFileAtomically(outFile, image.data(), image.size())) {
+        throw std::runtime_error("cannot write compiled mechanism: " + outFile);
+    }
+}
+
+// ========== CompiledMechanism ==========
+
+CompiledMechanism::CompiledMechanism(CompiledMechanism&& other) noexcept {
+    *this = std::move(other);
+}
+
+CompiledMechanism& CompiledMechanism::operator=(CompiledMechanism&& other) noexcept {
+    if (this != &other) {
+        unmap();
+        m_base = other.m_base;
+        m_size = other.m_size;
+#ifdef _WIN32
+        m_fileHandle = other.m_fileHandle;
+        m_mappingHandle = other.m_mappingHandle;
+        other.m_fileHandle = nullptr;
+        other.m_mappingHandle = nullptr;
+#endif
+        std::memcpy(m_sections, other.m_sections, sizeof(m_sections));
+        m_strings = other.m_strings;
+        m_sourceHash = other.m_sourceHash;
+        m_reactionCount = other.m_reactionCount;
+        m_thermoCount = other.m_thermoCount;
+        m_transportCount = other.m_transportCount;
+        m_stringCount = other.m_stringCount;
+        other.m_base = nullptr;
+        other.m_size = 0;
+    }
+    return *this;
+}
+
+CompiledMechanism::~CompiledMechanism() {
+    unmap();
+}
+
+void CompiledMechanism::unmap() {
+#ifdef _WIN32
+    if (m_base) UnmapViewOfFile(m_base);
+    if (m_mappingHandle) CloseHandle(m_mappingHandle);
+    if (m_fileHandle) CloseHandle(m_fileHandle);
+    m_fileHandle = nullptr;
+    m_mappingHandle = nullptr;
+#else
+    if (m_base) munmap(const_cast<char*>(m_base), m_size);
+#endif
+    m_base = nullptr;
+    m_size = 0;
+}
+
+CompiledMechanism CompiledMechanism::open(const std::string& file) {
+    CompiledMechanism mech;
+
+#ifdef _WIN32
+    HANDLE fileHandle = CreateFileA(file.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE,
+        nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error("cannot open compiled mechanism: " + file);
+    }
+    mech.m_fileHandle = fileHandle;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0) {
+        throw std::runtime_error("invalid compiled mechanism: " + file);
+    }
+    HANDLE mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mappingHandle) {
+        throw std::runtime_error("cannot map compiled mechanism: " + file);
+    }
+    mech.m_mappingHandle = mappingHandle;
+
+    void* base = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+    if (!base) {
+        throw std::runtime_error("cannot map compiled mechanism: " + file);
+    }
+    mech.m_base = static_cast<const char*>(base);
+    mech.m_size = static_cast<size_t>(fileSize.QuadPart);
+#else
+    int fd = ::open(file.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("cannot open compiled mechanism: " + file);
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        ::close(fd);
+        throw std::runtime_error("invalid compiled mechanism: " + file);
+    }
+    void* base = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (base == MAP_FAILED) {
+        throw std::runtime_error("cannot map compiled mechanism: " + file);
+    }
+    mech.m_base = static_cast<const char*>(base);
+    mech.m_size = static_cast<size_t>(st.st_size);
+#endif
+
+    mech.validate();
+    return mech;
+}
+
+void CompiledMechanism::validate() {
+    auto fail = [](const char* what) {
+        throw std::runtime_error(std::string("invalid compiled mechanism: ") + what);
+    };
+
+    CompiledHeader header;
+    if (m_size < sizeof(header) + sizeof(m_sections)) fail("file too small");
+    std::memcpy(&header, m_base, sizeof(header));
+    if (std::memcmp(header.magic, kCompiledMagic, sizeof(header.magic)) != 0) fail("bad magic");
+    if (header.version != kCompiledMechanismVersion) fail("version mismatch");
+    if (header.byteOrder != kByteOrderMark) fail("byte order mismatch");
+    if (header.sectionCount != kSectionCount) fail("section count mismatch");
+    std::memcpy(m_sections, m_base + sizeof(header), sizeof(m_sections));
+
+    for (const auto& entry : m_sections) {
+        if (entry.offset % kAlignment != 0 || entry.offset > m_size || entry.size > m_size - entry.offset) {
+            fail("section out of range");
+        }
+    }
+
+    m_sourceHash = header.sourceHash;
+    m_reactionCount = header.reactionCount;
+    m_thermoCount = header.thermoCount;
+    m_transportCount = header.transportCount;
+    m_strings = m_base + m_sections[static_cast<size_t>(CompiledSection::StringBytes)].offset;
+
+    auto elements = [this](CompiledSection section, size_t elementSize) {
+        return m_sections[static_cast<size_t>(section)].size / elementSize;
+    };
+    auto expect = [&](CompiledSection section, size_t elementSize, size_t n) {
+        if (m_sections[static_cast<size_t>(section)].size != n * elementSize) fail("section size mismatch");
+    };
+
+    // 下标数组单调不减且不超过值数组长度
+    auto checkOffsets = [&](CompiledSection offsets, size_t rows, size_t limit) {
+        expect(offsets, sizeof(uint32_t), rows + 1);
+        ArrayView<uint32_t> o = array<uint32_t>(offsets);
+        if (o[0] != 0) fail("bad offsets");
+        for (size_t i = 0; i < rows; i++) {
+            if (o[i + 1] < o[i]) fail("bad offsets");
+        }
+        if (o[rows] != limit) fail("bad offsets");
+    };
+
+    size_t stringOffsets = elements(CompiledSection::StringOffsets, sizeof(uint32_t));
+    if (stringOffsets == 0) fail("missing string table");
+    m_stringCount = stringOffsets - 1;
+    checkOffsets(CompiledSection::StringOffsets, m_stringCount,
+        m_sections[static_cast<size_t>(CompiledSection::StringBytes)].size);
+
+    auto checkStrings = [&](CompiledSection section, size_t n) {
+        expect(section, sizeof(uint32_t), n);
+        for (uint32_t id : array<uint32_t>(section)) {
+            if (id >= m_stringCount) fail("bad string id");
+        }
+    };
+    auto checkNamedRows = [&](CompiledSection offsets, CompiledSection names, CompiledSection values, size_t rows) {
+        size_t n = elements(values, sizeof(double));
+        checkOffsets(offsets, rows, n);
+        checkStrings(names, n);
+    };
+    auto checkRows = [&](CompiledSection offsets, CompiledSection values, size_t rows) {
+        checkOffsets(offsets, rows, elements(values, sizeof(double)));
+    };
+
+    checkStrings(CompiledSection::Units, 4);
+
+    size_t nR = m_reactionCount;
+    checkStrings(CompiledSection::ReactionEquation, nR);
+    checkStrings(CompiledSection::ReactionType, nR);
+    checkStrings(CompiledSection::ReactionAUnits, nR);
+    checkStrings(CompiledSection::ReactionEaUnits, nR);
+    checkStrings(CompiledSection::ReactionFalloffForm, nR);
+    expect(CompiledSection::ReactionFlags, sizeof(uint32_t), nR);
+    for (CompiledSection section : { CompiledSection::RateA, CompiledSection::RateB, CompiledSection::RateEa,
+        CompiledSection::LowA, CompiledSection::LowB, CompiledSection::LowEa, CompiledSection::TroeA,
+        CompiledSection::TroeT3, CompiledSection::TroeT1, CompiledSection::TroeT2 }) {
+        expect(section, sizeof(double), nR);
+    }
+    checkNamedRows(CompiledSection::EfficiencyOffsets, CompiledSection::EfficiencySpecies,
+        CompiledSection::EfficiencyValues, nR);
+    checkNamedRows(CompiledSection::OrderOffsets, CompiledSection::OrderSpecies,
+        CompiledSection::OrderValues, nR);
+
+    size_t nT = m_thermoCount;
+    checkStrings(CompiledSection::ThermoName, nT);
+    checkStrings(CompiledSection::ThermoModel, nT);
+    checkNamedRows(CompiledSection::CompositionOffsets, CompiledSection::CompositionElement,
+        CompiledSection::CompositionValues, nT);
+    checkRows(CompiledSection::TemperatureRangeOffsets, CompiledSection::TemperatureRangeValues, nT);
+    checkRows(CompiledSection::Nasa7LowOffsets, CompiledSection::Nasa7LowValues, nT);
+    checkRows(CompiledSection::Nasa7HighOffsets, CompiledSection::Nasa7HighValues, nT);
+    size_t nasa9Ranges = elements(CompiledSection::Nasa9TRangeOffsets, sizeof(uint32_t));
+    if (nasa9Ranges == 0) fail("bad offsets");
+    nasa9Ranges--;
+    checkOffsets(CompiledSection::Nasa9RangeOffsets, nT, nasa9Ranges);
+    checkRows(CompiledSection::Nasa9TRangeOffsets, CompiledSection::Nasa9TRangeValues, nasa9Ranges);
+    checkRows(CompiledSection::Nasa9CoeffOffsets, CompiledSection::Nasa9CoeffValues, nasa9Ranges);
+
+    size_t nX = m_transportCount;
+    checkStrings(CompiledSection::TransportName, nX);
+    checkStrings(CompiledSection::TransportModel, nX);
+    checkStrings(CompiledSection::TransportGeometry, nX);
+    checkStrings(CompiledSection::TransportNote, nX);
+    for (CompiledSection section : { CompiledSection::TransportDiameter, CompiledSection::TransportWellDepth,
+        CompiledSection::TransportDipole, CompiledSection::TransportPolarizability,
+        CompiledSection::TransportRotationalRelaxation }) {
+        expect(section, sizeof(double), nX);
+    }
+}
+
+// ========== 访问器 ==========
+
+UnitSystem CompiledMechanism::units() const {
+    ArrayView<uint32_t> ids = array<uint32_t>(CompiledSection::Units);
+    UnitSystem result;
+    result.length = std::string(string(ids[0]));
+    result.time = std::string(string(ids[1]));
+    result.quantity = std::string(string(ids[2]));
+    result.activationEnergy = std::string(string(ids[3]));
+    return result;
+}
+
+std::string_view NamedValuesView::name(size_t k) const {
+    return m_mech->string(m_names[k]);
+}
+
+std::string_view CompiledReaction::equation() const {
+    return m_mech->string(m_mech->array<uint32_t>(CompiledSection::ReactionEquation)[m_i]);
+}
+
+std::string_view CompiledReaction::type() const {
+    return m_mech->string(m_mech->array<uint32_t>(CompiledSection::ReactionType)[m_i]);
+}
+
+double CompiledReaction::A() const { return m_mech->array<double>(CompiledSection::RateA)[m_i]; }
+double CompiledReaction::b() const { return m_mech->array<double>(CompiledSection::RateB)[m_i]; }
+double CompiledReaction::Ea() const { return m_mech->array<double>(CompiledSection::RateEa)[m_i]; }
+
+std::string_view CompiledReaction::A_units() const {
+    return m_mech->string(m_mech->array<uint32_t>(CompiledSection::ReactionAUnits)[m_i]);
+}
+
+std::string_view CompiledReaction::Ea_units() const {
+    return m_mech->string(m_mech->array<uint32_t>(CompiledSection::ReactionEaUnits)[m_i]);
+}
+
+double CompiledReaction::lowA() const { return m_mech->array<double>(CompiledSection::LowA)[m_i]; }
+double CompiledReaction::lowB() const { return m_mech->array<double>(CompiledSection::LowB)[m_i]; }
+double CompiledReaction::lowEa() const { return m_mech->array<double>(CompiledSection::LowEa)[m_i]; }
+double CompiledReaction::troeA() const { return m_mech->array<double>(CompiledSection::TroeA)[m_i]; }
+double CompiledReaction::troeTStar() const { return m_mech->array<double>(CompiledSection::TroeT1)[m_i]; }
+double CompiledReaction::troeTDoubleStar() const { return m_mech->array<double>(CompiledSection::TroeT2)[m_i]; }
+double CompiledReaction::troeTTripleStar() const { return m_mech->array<double>(CompiledSection::TroeT3)[m_i]; }
+
+std::string_view CompiledReaction::falloffForm() const {
+    return m_mech->string(m_mech->array<uint32_t>(CompiledSection::ReactionFalloffForm)[m_i]);
+}
+
+bool CompiledReaction::isDuplicate() const {
+    return (m_mech->array<uint32_t>(CompiledSection::ReactionFlags)[m_i] & 1u) != 0;
+}
+
+NamedValuesView CompiledReaction::efficiencies() const {
+    return m_mech->namedRow(CompiledSection::EfficiencyOffsets, CompiledSection::EfficiencySpecies,
+        CompiledSection::EfficiencyValues, m_i);
+}
+
+NamedValuesView CompiledReaction::orders() const {
+    return m_mech->namedRow(CompiledSection::OrderOffsets, CompiledSection::OrderSpecies,
+        CompiledSection::OrderValues, m_i);
+}
+
+std::string_view CompiledThermo::name() const {
+    return m_mech->string(m_mech->array<uint32_t>(CompiledSection::ThermoName)[m_i]);
+}
+
+std::string_view CompiledThermo::model() const {
+    return m_mech->string(m_mech->array<uint32_t>(CompiledSection::ThermoModel)[m_i]);
+}
+
+NamedValuesView CompiledThermo::composition() const {
+    return m_mech->namedRow(CompiledSection::CompositionOffsets, CompiledSection::CompositionElement,
+        CompiledSection::CompositionValues, m_i);
+}
+
+ArrayView<double> CompiledThermo::temperatureRanges() const {
+    return m_mech->rowValues<double>(CompiledSection::TemperatureRangeOffsets,
+        CompiledSection::TemperatureRangeValues, m_i);
+}
+
+ArrayView<double> CompiledThermo::nasa7Low() const {
+    return m_mech->rowValues<double>(CompiledSection::Nasa7LowOffsets, CompiledSection::Nasa7LowValues, m_i);
+}
+
+ArrayView<double> CompiledThermo::nasa7High() const {
+    return m_mech->rowValues<double>(CompiledSection::Nasa7HighOffsets, CompiledSection::Nasa7HighValues, m_i);
+}
+
+size_t CompiledThermo::nasa9RangeCount() const {
+    auto [first, last] = m_mech->row(CompiledSection::Nasa9RangeOffsets, m_i);
+    return last - first;
+}
+
+ArrayView<double> CompiledThermo::nasa9TemperatureRange(size_t range) const {
+    size_t r = m_mech->row(CompiledSection::Nasa9RangeOffsets, m_i).first + range;
+    return m_mech->rowValues<double>(CompiledSection::Nasa9TRangeOffsets, CompiledSection::Nasa9TRangeValues, r);
+}
+
+ArrayView<double> CompiledThermo::nasa9Coefficients(size_t range) const {
+    size_t r = m_mech->row(CompiledSection::Nasa9RangeOffsets, m_i).first + range;
+    return m_mech->rowValues<double>(CompiledSection::Nasa9CoeffOffsets, CompiledSection::Nasa9CoeffValues, r);
+}
+
+std::string_view CompiledTransport::name() const {
+    return m_mech->string(m_mech->array<uint32_t>(CompiledSection::TransportName)[m_i]);
+}
+
+std::string_view CompiledTransport::model() const {
+    return m_mech->string(m_mech->array<uint32_t>(CompiledSection::TransportModel)[m_i]);
+}
+
+std::string_view CompiledTransport::geometry() const {
+    return m_mech->string(m_mech->array<uint32_t>(CompiledSection::TransportGeometry)[m_i]);
+}
+
+double CompiledTransport::diameter() const {
+    return m_mech->array<double>(CompiledSection::TransportDiameter)[m_i];
+}
+
+double CompiledTransport::wellDepth() const {
+    return m_mech->array<double>(CompiledSection::TransportWellDepth)[m_i];
+}
+
+double CompiledTransport::dipole() const {
+    return m_mech->array<double>(CompiledSection::TransportDipole)[m_i];
+}
+
+double CompiledTransport::polarizability() const {
+    return m_mech->array<double>(CompiledSection::TransportPolarizability)[m_i];
+}
+
+double CompiledTransport::rotationalRelaxation() const {
+    return m_mech->array<double>(CompiledSection::TransportRotationalRelaxation)[m_i];
+}
+
+std::string_view CompiledTransport::note() const {
+    return m_mech->string(m_mech->array<uint32_t>(CompiledSection::TransportNote)[m_i]);
+}
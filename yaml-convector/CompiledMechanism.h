@@ -0,0 +1,296 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <utility>
+#include "Mechanism.h"
+
+// ========== 编译后的机理文件(内存映射, 零拷贝) ==========
+// 文件由若干段组成, 每段是一个定长元素数组, 起始位置按8字节对齐:
+//   - 数值参数按字段分开存放(结构数组转为数组结构), 如 Arrhenius 的 A/b/Ea、低压限、Troe参数
+//   - 字符串统一存入字符串池, 记录中只保存 uint32 字符串编号, 相同字符串只存一份
+//   - 第三体效率、反应级数、元素组成、温度区间和多项式系数等变长数据使用CSR:
+//     offsets[i]..offsets[i+1] 为第 i 条记录在值数组中的范围
+// 打开文件时只做 mmap 和段表校验, 不做反序列化; 同一文件被多个进程打开时共享页缓存
+
+// 版本2: 增加 ReactionFalloffForm 段
+constexpr uint32_t kCompiledMechanismVersion = 2;
+
+// 段编号, 顺序即段表顺序
+enum class CompiledSection : uint32_t {
+    StringOffsets,      // uint32[字符串数 + 1]
+    StringBytes,        // char[]
+
+    ReactionEquation,   // uint32 字符串编号
+    ReactionType,
+    ReactionAUnits,
+    ReactionEaUnits,
+    ReactionFalloffForm,
+    ReactionFlags,      // uint32, 位0: duplicate
+    RateA,              // double
+    RateB,
+    RateEa,
+    LowA,
+    LowB,
+    LowEa,
+    TroeA,
+    TroeT3,             // T***
+    TroeT1,             // T*
+    TroeT2,             // T**
+    EfficiencyOffsets,  // uint32[反应数 + 1]
+    EfficiencySpecies,  // uint32 字符串编号
+    EfficiencyValues,   // double
+    OrderOffsets,
+    OrderSpecies,
+    OrderValues,
+
+    ThermoName,
+    ThermoModel,
+    CompositionOffsets,
+    CompositionElement,
+    CompositionValues,
+    TemperatureRangeOffsets,
+    TemperatureRangeValues,
+    Nasa7LowOffsets,
+    Nasa7LowValues,
+    Nasa7HighOffsets,
+    Nasa7HighValues,
+    Nasa9RangeOffsets,  // uint32[物种数 + 1], 指向NASA9温度区间表
+    Nasa9TRangeOffsets, // uint32[区间数 + 1]
+    Nasa9TRangeValues,
+    Nasa9CoeffOffsets,
+    Nasa9CoeffValues,
+
+    TransportName,
+    TransportModel,
+    TransportGeometry,
+    TransportNote,
+    TransportDiameter,  // double
+    TransportWellDepth,
+    TransportDipole,
+    TransportPolarizability,
+    TransportRotationalRelaxation,
+
+    Units,              // uint32[4] 字符串编号: length, time, quantity, activation-energy
+
+    Count
+};
+
+// 把 MechanismData 写成编译后的机理文件(写临时文件后原子替换, 见 AtomicFile.h), 失败时抛出 std::runtime_error
+// sourceHash 记录源YAML的内容哈希(见 hashMechanismSource), 供调用方判断文件是否过期
+void compileMechanism(const MechanismData& mechanism, const std::string& outFile, uint64_t sourceHash = 0);
+
+// 只读连续数组视图
+template <typename T>
+class ArrayView {
+public:
+    ArrayView() = default;
+    ArrayView(const T* data, size_t size) : m_data(data), m_size(size) {}
+
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+    const T* data() const { return m_data; }
+    const T& operator[](size_t i) const { return m_data[i]; }
+    const T* begin() const { return m_data; }
+    const T* end() const { return m_data + m_size; }
+
+private:
+    const T* m_data = nullptr;
+    size_t m_size = 0;
+};
+
+class CompiledMechanism;
+
+// CSR 中一行(名称, 数值)对的视图, 如一个反应的第三体效率
+class NamedValuesView {
+public:
+    class iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<std::string_view, double>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = value_type;
+
+        iterator(const NamedValuesView* view, size_t i) : m_view(view), m_i(i) {}
+
+        value_type operator*() const { return value_type(m_view->name(m_i), m_view->value(m_i)); }
+        iterator& operator++() { ++m_i; return *this; }
+        bool operator==(const iterator& other) const { return m_i == other.m_i; }
+        bool operator!=(const iterator& other) const { return m_i != other.m_i; }
+
+    private:
+        const NamedValuesView* m_view;
+        size_t m_i;
+    };
+
+    NamedValuesView(const CompiledMechanism* mech, ArrayView<uint32_t> names, ArrayView<double> values)
+        : m_mech(mech), m_names(names), m_values(values) {}
+
+    size_t size() const { return m_names.size(); }
+    bool empty() const { return m_names.empty(); }
+    std::string_view name(size_t k) const;
+    double value(size_t k) const { return m_values[k]; }
+    uint32_t nameId(size_t k) const { return m_names[k]; }
+
+    iterator begin() const { return iterator(this, 0); }
+    iterator end() const { return iterator(this, size()); }
+
+private:
+    const CompiledMechanism* m_mech;
+    ArrayView<uint32_t> m_names;
+    ArrayView<double> m_values;
+};
+
+// 单个反应的只读视图
+class CompiledReaction {
+public:
+    CompiledReaction(const CompiledMechanism* mech, size_t i) : m_mech(mech), m_i(i) {}
+
+    std::string_view equation() const;
+    std::string_view type() const;
+    double A() const;
+    double b() const;
+    double Ea() const;
+    std::string_view A_units() const;
+    std::string_view Ea_units() const;
+    double lowA() const;
+    double lowB() const;
+    double lowEa() const;
+    double troeA() const;
+    double troeTStar() const;
+    double troeTDoubleStar() const;
+    double troeTTripleStar() const;
+    std::string_view falloffForm() const;
+    bool isDuplicate() const;
+    NamedValuesView efficiencies() const;
+    NamedValuesView orders() const;
+
+private:
+    const CompiledMechanism* m_mech;
+    size_t m_i;
+};
+
+// 单个物种热力学数据的只读视图
+class CompiledThermo {
+public:
+    CompiledThermo(const CompiledMechanism* mech, size_t i) : m_mech(mech), m_i(i) {}
+
+    std::string_view name() const;
+    std::string_view model() const;
+    NamedValuesView composition() const;
+    ArrayView<double> temperatureRanges() const;
+    ArrayView<double> nasa7Low() const;
+    ArrayView<double> nasa7High() const;
+    size_t nasa9RangeCount() const;
+    ArrayView<double> nasa9TemperatureRange(size_t range) const;
+    ArrayView<double> nasa9Coefficients(size_t range) const;
+
+private:
+    const CompiledMechanism* m_mech;
+    size_t m_i;
+};
+
+// 单个物种输运性质的只读视图
+class CompiledTransport {
+public:
+    CompiledTransport(const CompiledMechanism* mech, size_t i) : m_mech(mech), m_i(i) {}
+
+    std::string_view name() const;
+    std::string_view model() const;
+    std::string_view geometry() const;
+    double diameter() const;
+    double wellDepth() const;
+    double dipole() const;
+    double polarizability() const;
+    double rotationalRelaxation() const;
+    std::string_view note() const;
+
+private:
+    const CompiledMechanism* m_mech;
+    size_t m_i;
+};
+
+// 以只读方式映射编译后的机理文件, 访问器直接读取映射内存
+class CompiledMechanism {
+public:
+    CompiledMechanism() = default;
+    CompiledMechanism(CompiledMechanism&& other) noexcept;
+    CompiledMechanism& operator=(CompiledMechanism&& other) noexcept;
+    CompiledMechanism(const CompiledMechanism&) = delete;
+    CompiledMechanism& operator=(const CompiledMechanism&) = delete;
+    ~CompiledMechanism();
+
+    // 映射并校验文件(魔数、版本、字节序、段表范围和CSR下标), 失败时抛出 std::runtime_error
+    static CompiledMechanism open(const std::string& file);
+
+    uint64_t sourceHash() const { return m_sourceHash; }
+    // 机理文件的默认单位(复制为字符串)
+    UnitSystem units() const;
+    size_t fileBytes() const { return m_size; }
+
+    size_t reactionCount() const { return m_reactionCount; }
+    size_t thermoCount() const { return m_thermoCount; }
+    size_t transportCount() const { return m_transportCount; }
+    size_t stringCount() const { return m_stringCount; }
+
+    CompiledReaction reaction(size_t i) const { return CompiledReaction(this, i); }
+    CompiledThermo thermo(size_t i) const { return CompiledThermo(this, i); }
+    CompiledTransport transport(size_t i) const { return CompiledTransport(this, i); }
+
+    std::string_view string(uint32_t id) const {
+        const uint32_t* offsets = array<uint32_t>(CompiledSection::StringOffsets).data();
+        return std::string_view(m_strings + offsets[id], offsets[id + 1] - offsets[id]);
+    }
+
+    // 整段数组, 供批量计算直接使用(如全部反应的 A 值)
+    template <typename T>
+    ArrayView<T> array(CompiledSection section) const {
+        const auto& entry = m_sections[static_cast<size_t>(section)];
+        return ArrayView<T>(reinterpret_cast<const T*>(m_base + entry.offset), entry.size / sizeof(T));
+    }
+
+    // CSR 第 i 行在值数组中的范围
+    std::pair<uint32_t, uint32_t> row(CompiledSection offsets, size_t i) const {
+        const uint32_t* o = array<uint32_t>(offsets).data();
+        return { o[i], o[i + 1] };
+    }
+
+    template <typename T>
+    ArrayView<T> rowValues(CompiledSection offsets, CompiledSection values, size_t i) const {
+        auto [first, last] = row(offsets, i);
+        return ArrayView<T>(array<T>(values).data() + first, last - first);
+    }
+
+    NamedValuesView namedRow(CompiledSection offsets, CompiledSection names,
+        CompiledSection values, size_t i) const {
+        return NamedValuesView(this, rowValues<uint32_t>(offsets, names, i),
+            rowValues<double>(offsets, values, i));
+    }
+
+    struct SectionEntry {
+        uint64_t offset;
+        uint64_t size;
+    };
+
+private:
+    void validate();
+    void unmap();
+
+    const char* m_base = nullptr;
+    size_t m_size = 0;
+#ifdef _WIN32
+    void* m_fileHandle = nullptr;
+    void* m_mappingHandle = nullptr;
+#endif
+
+    SectionEntry m_sections[static_cast<size_t>(CompiledSection::Count)] = {};
+    const char* m_strings = nullptr;
+    uint64_t m_sourceHash = 0;
+    size_t m_reactionCount = 0;
+    size_t m_thermoCount = 0;
+    size_t m_transportCount = 0;
+    size_t m_stringCount = 0;
+};
@@ -0,0 +1,41 @@
+#include "Elements.h"
+#include <stdexcept>
+
+namespace {
+
+struct Element {
+    std::string_view symbol;
+    double weight;
+};
+
+constexpr Element kElements[] = {
+    { "H", 1.008 }, { "He", 4.002602 }, { "Li", 6.94 }, { "Be", 9.0121831 }, { "B", 10.81 },
+    { "C", 12.011 }, { "N", 14.007 }, { "O", 15.999 }, { "F", 18.998403163 }, { "Ne", 20.1797 },
+    { "Na", 22.98976928 }, { "Mg", 24.305 }, { "Al", 26.9815385 }, { "Si", 28.085 }, { "P", 30.973761998 },
+    { "S", 32.06 }, { "Cl", 35.45 }, { "Ar", 39.948 }, { "K", 39.0983 }, { "Ca", 40.078 },
+    { "Sc", 44.955908 }, { "Ti", 47.867 }, { "V", 50.9415 }, { "Cr", 51.9961 }, { "Mn", 54.938044 },
+    { "Fe", 55.845 }, { "Co", 58.933194 }, { "Ni", 58.6934 }, { "Cu", 63.546 }, { "Zn", 65.38 },
+    { "Ga", 69.723 }, { "Ge", 72.63 }, { "As", 74.921595 }, { "Se", 78.971 }, { "Br", 79.904 },
+    { "Kr", 83.798 }, { "Rb", 85.4678 }, { "Sr", 87.62 }, { "Y", 88.90584 }, { "Zr", 91.224 },
+    { "Nb", 92.90637 }, { "Mo", 95.95 }, { "Tc", 97.0 }, { "Ru", 101.07 }, { "Rh", 102.9055 },
+    { "Pd", 106.42 }, { "Ag", 107.8682 }, { "Cd", 112.414 }, { "In", 114.818 }, { "Sn", 118.71 },
+    { "Sb", 121.76 }, { "Te", 127.6 }, { "I", 126.90447 }, { "Xe", 131.293 },
+    { "D", 2.014102 }, { "T", 3.016049 }, { "E", 5.48579909e-4 },
+};
+
+} // namespace
+
+double atomicWeight(std::string_view symbol) {
+    for (const auto& element : kElements) {
+        if (element.symbol == symbol) return element.weight;
+    }
+    throw std::runtime_error("未知元素 '" + std::string(symbol) + "'");
+}
+
+double molecularWeight(const std::map<std::string, double>& composition) {
+    double weight = 0.0;
+    for (const auto& [symbol, count] : composition) {
+        weight += atomicWeight(symbol) * count;
+    }
+    return weight;
+}
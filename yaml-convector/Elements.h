@@ -0,0 +1,13 @@
+#pragma once
+#include <map>
+#include <string>
+#include <string_view>
+
+// ========== 元素原子量 ==========
+// IUPAC 标准原子量 [kg/kmol], 收录 H 到 Xe 以及同位素 D、T 和电子 E
+
+// 元素符号区分大小写(与 Cantera 相同), 未知元素抛出 std::runtime_error
+double atomicWeight(std::string_view symbol);
+
+// 由元素组成(composition 字段)计算分子量 [kg/kmol]
+double molecularWeight(const std::map<std::string, double>& composition);
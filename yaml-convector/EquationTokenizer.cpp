@@ -0,0 +1,171 @@
+#include "EquationTokenizer.h"
+#include <charconv>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+bool isSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+bool isDigit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+std::string_view trim(std::string_view text) {
+    while (!text.empty() && isSpace(text.front())) text.remove_prefix(1);
+    while (!text.empty() && isSpace(text.back())) text.remove_suffix(1);
+    return text;
+}
+
+[[noreturn]] void fail(std::string_view equation, const char* message) {
+    throw std::runtime_error("反应方程 '" + std::string(equation) + "': " + message);
+}
+
+// 逐个读取以空白分隔的词
+class WordReader {
+public:
+    explicit WordReader(std::string_view text) : m_text(text) {}
+
+    bool next(std::string_view& word) {
+        while (m_pos < m_text.size() && isSpace(m_text[m_pos])) m_pos++;
+        if (m_pos >= m_text.size()) return false;
+        size_t begin = m_pos;
+        while (m_pos < m_text.size() && !isSpace(m_text[m_pos])) m_pos++;
+        word = m_text.substr(begin, m_pos - begin);
+        return true;
+    }
+
+    // 从当前位置读到 ')' (含), 用于 "(+ M)" 这类被空白拆开的碰撞体
+    bool readUntilClose(std::string_view& rest) {
+        size_t close = m_text.find(')', m_pos);
+        if (close == std::string_view::npos) return false;
+        rest = m_text.substr(m_pos, close + 1 - m_pos);
+        m_pos = close + 1;
+        return true;
+    }
+
+private:
+    std::string_view m_text;
+    size_t m_pos = 0;
+};
+
+void addTerm(std::vector<EquationTerm>& terms, size_t sideBegin, std::string_view species, double stoich) {
+    for (size_t i = sideBegin; i < terms.size(); i++) {
+        if (terms[i].species == species) {
+            terms[i].stoich += stoich;
+            return;
+        }
+    }
+    terms.push_back({ species, stoich });
+}
+
+// "(+X)" 中的 X; 不是碰撞体写法时返回 false
+bool colliderName(std::string_view group, std::string_view& name) {
+    if (group.size() < 3 || group.substr(0, 2) != "(+" || group.back() != ')') return false;
+    name = trim(group.substr(2, group.size() - 3));
+    return !name.empty();
+}
+
+void parseSide(std::string_view equation, std::string_view side, std::vector<EquationTerm>& terms,
+    ParsedEquation& result) {
+    const size_t sideBegin = terms.size();
+    WordReader reader(side);
+    std::string_view word;
+    double pending = 1.0;
+    bool hasPending = false;
+
+    auto setCollider = [&](ThirdBodyMarker marker, std::string_view name) {
+        result.thirdBody = marker;
+        result.collider = name;
+    };
+
+    while (reader.next(word)) {
+        if (word == "+") continue;
+
+        // 单独的 "(+M)" / "(+ M)" / "(+AR)"
+        if (word.size() >= 2 && word.substr(0, 2) == "(+") {
+            std::string_view group = word;
+            if (word.back() != ')') {
+                std::string_view rest;
+                if (!reader.readUntilClose(rest)) fail(equation, "碰撞体缺少 ')'");
+                group = std::string_view(word.data(), static_cast<size_t>(rest.data() + rest.size() - word.data()));
+            }
+            std::string_view name;
+            if (!colliderName(group, name)) fail(equation, "无效的碰撞体");
+            setCollider(ThirdBodyMarker::Falloff, name);
+            continue;
+        }
+
+        if (word == "M" && !hasPending) {
+            if (result.thirdBody == ThirdBodyMarker::None) setCollider(ThirdBodyMarker::ThreeBody, word);
+            continue;
+        }
+
+        // 化学计量数
+        if (isDigit(word.front()) || word.front() == '.') {
+            double value = 0.0;
+            auto parsed = std::from_chars(word.data(), word.data() + word.size(), value);
+            if (parsed.ec == std::errc()) {
+                size_t length = static_cast<size_t>(parsed.ptr - word.data());
+                if (length == word.size()) {
+                    pending = value;
+                    hasPending = true;
+                    continue;
+                }
+                if (word[length] >= 'A' && word[length] <= 'Z') {
+                    pending = value;
+                    hasPending = true;
+                    word.remove_prefix(length);
+                }
+            }
+        }
+
+        // 紧跟在物种名后的 "(+M)", 括号内可能有空白("O2(+ M)")
+        size_t open = word.rfind("(+");
+        if (open != std::string_view::npos && open > 0 && word.find(')', open) == std::string_view::npos) {
+            std::string_view rest;
+            if (!reader.readUntilClose(rest)) fail(equation, "碰撞体缺少 ')'");
+            word = std::string_view(word.data(), static_cast<size_t>(rest.data() + rest.size() - word.data()));
+        }
+        std::string_view name;
+        if (open != std::string_view::npos && open > 0 && colliderName(word.substr(open), name)) {
+            setCollider(ThirdBodyMarker::Falloff, name);
+            word = word.substr(0, open);
+        }
+
+        addTerm(terms, sideBegin, word, pending);
+        pending = 1.0;
+        hasPending = false;
+    }
+
+    if (hasPending) fail(equation, "化学计量数后缺少物种");
+    if (terms.size() == sideBegin) fail(equation, "反应物或产物为空");
+}
+
+} // namespace
+
+ParsedEquation tokenizeEquation(std::string_view equation, std::vector<EquationTerm>& terms) {
+    terms.clear();
+    ParsedEquation result;
+
+    size_t arrow = equation.find("<=>");
+    size_t arrowLength = 3;
+    if (arrow == std::string_view::npos) {
+        arrow = equation.find("=>");
+        arrowLength = 2;
+        result.reversible = false;
+        if (arrow == std::string_view::npos) {
+            arrow = equation.find('=');
+            arrowLength = 1;
+            result.reversible = true;
+        }
+    }
+    if (arrow == std::string_view::npos) fail(equation, "缺少反应箭头");
+
+    parseSide(equation, equation.substr(0, arrow), terms, result);
+    result.reactantCount = terms.size();
+    parseSide(equation, equation.substr(arrow + arrowLength), terms, result);
+    return result;
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+// ========== 反应方程分词 ==========
+// 直接在 std::string_view 上扫描, 物种名以指向原字符串的 string_view 返回, 不复制.
+// 规则(与 Cantera 相同):
+//   - 以空白分隔, 单独的 "+" 为分隔符, 因此 "H+"、"C2H4+" 这类含 '+' 的名称保持完整
+//   - 箭头为 "<=>"、"=" (可逆) 或 "=>" (不可逆)
+//   - 数字开头的词: 整个为数字时是下一个物种的化学计量数; 数字后紧跟大写字母时拆为系数和物种(如 "2OH"),
+//     否则整个是物种名(如 "1-C4H8")
+//   - 单独的 "M" 为三体标记; "(+M)"、"(+ M)"、"(+AR)" 为衰减碰撞体, 可单独成词或紧跟在物种名后("O2(+M)");
+//     括号内为空的 "C2H4(+)" 和不以 "(+" 开头的 "CH2(S)" 都是物种名
+//   - 同一侧重复出现的物种合并化学计量数
+
+struct EquationTerm {
+    std::string_view species;
+    double stoich;
+};
+
+enum class ThirdBodyMarker : uint8_t {
+    None,
+    ThreeBody,      // "+ M"
+    Falloff         // "(+M)" 或 "(+物种)"
+};
+
+struct ParsedEquation {
+    size_t reactantCount = 0;       // terms[0, reactantCount) 为反应物, 其余为产物
+    bool reversible = true;
+    ThirdBodyMarker thirdBody = ThirdBodyMarker::None;
+    std::string_view collider;      // "M" 或指定碰撞体名称; 无标记时为空
+};
+
+// 分词结果写入 terms(先清空; 容量足够时不分配内存), 返回值中的 string_view 指向 equation.
+// 缺少箭头、某一侧为空或碰撞体括号不完整时抛出 std::runtime_error
+ParsedEquation tokenizeEquation(std::string_view equation, std::vector<EquationTerm>& terms);
@@ -0,0 +1,170 @@
+#include "FalloffKernel.h"
+#include "SimdMath.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// 每块的衰减反应数, 四个中间数组共 8 KB
+constexpr size_t kBlockSize = 256;
+// 批量计算时每次转置的状态数(一行 64 字节)
+constexpr size_t kStateTile = 8;
+constexpr double kSmallNumber = 1e-300;
+
+} // namespace
+
+FalloffKernel::FalloffKernel(const CompiledKinetics& kinetics)
+    : m_reactions(kinetics.falloff.reaction), m_troeCount(kinetics.falloff.troeCount) {
+    const FalloffBlock& falloff = kinetics.falloff;
+    const size_t count = falloff.size();
+
+    std::vector<double> highA(count), highB(count), highEa(count);
+    for (size_t j = 0; j < count; j++) {
+        size_t i = falloff.reaction[j];
+        highA[j] = kinetics.A[i];
+        highB[j] = kinetics.b[i];
+        highEa[j] = kinetics.Ea[i];
+    }
+    m_high = ArrheniusKernel(highA, highB, highEa);
+    m_low = ArrheniusKernel(falloff.lowA, falloff.lowB, falloff.lowEa);
+
+    m_troeA = falloff.troeA;
+    m_troeT2 = falloff.troeT2;
+    m_troeInvT3.resize(m_troeCount);
+    m_troeInvT1.resize(m_troeCount);
+    m_troeT2Weight.resize(m_troeCount);
+    for (size_t j = 0; j < m_troeCount; j++) {
+        m_troeInvT3[j] = std::fabs(falloff.troeT3[j]) > kSmallNumber ? 1.0 / falloff.troeT3[j] : 1000.0;
+        m_troeInvT1[j] = std::fabs(falloff.troeT1[j]) > kSmallNumber ? 1.0 / falloff.troeT1[j] : 1000.0;
+        m_troeT2Weight[j] = falloff.troeT2[j] != 0.0 ? 1.0 : 0.0;
+    }
+}
+
+void FalloffKernel::evaluate(double T, const double* thirdBody, double* k) const {
+    evaluate(T, thirdBody, k, nullptr, nullptr);
+}
+
+void FalloffKernel::evaluate(double T, const double* thirdBody, double* k, double* dkdM, double* dkdT) const {
+    // Troe 和 Lindemann 分开分块, 每块内只有一种类型
+    auto blocks = [&](size_t first, size_t last) {
+        for (size_t begin = first; begin < last; begin += kBlockSize) {
+            evaluateBlock(T, begin, std::min(begin + kBlockSize, last), thirdBody + begin, k + begin,
+                dkdM ? dkdM + begin : nullptr, dkdT ? dkdT + begin : nullptr);
+        }
+    };
+    blocks(0, m_troeCount);
+    blocks(m_troeCount, size());
+}
+
+void FalloffKernel::evaluate(const double* T, size_t stateCount, const double* thirdBody, double* k) const {
+    // 按反应存放(同一反应的各状态连续): 每次取一块反应、kStateTile 个状态, 把 [M] 转置到栈上按状态计算,
+    // 再转置写回, 每行读写的是连续的 kStateTile 个数
+    double M[kStateTile][kBlockSize];
+    double result[kStateTile][kBlockSize];
+    auto blocks = [&](size_t first, size_t last) {
+        for (size_t begin = first; begin < last; begin += kBlockSize) {
+            const size_t end = std::min(begin + kBlockSize, last);
+            for (size_t s0 = 0; s0 < stateCount; s0 += kStateTile) {
+                const size_t tile = std::min(kStateTile, stateCount - s0);
+                for (size_t j = begin; j < end; j++) {
+                    const double* row = thirdBody + j * stateCount + s0;
+                    for (size_t s = 0; s < tile; s++) M[s][j - begin] = row[s];
+                }
+                for (size_t s = 0; s < tile; s++) {
+                    evaluateBlock(T[s0 + s], begin, end, M[s], result[s], nullptr, nullptr);
+                }
+                for (size_t j = begin; j < end; j++) {
+                    double* row = k + j * stateCount + s0;
+                    for (size_t s = 0; s < tile; s++) row[s] = result[s][j - begin];
+                }
+            }
+        }
+    };
+    blocks(0, m_troeCount);
+    blocks(m_troeCount, size());
+}
+
+void FalloffKernel::evaluateBlock(double T, size_t begin, size_t end, const double* thirdBody, double* k,
+    double* dkdM, double* dkdT) const {
+    using simd::Vec;
+    double kHigh[kBlockSize];
+    double kLow[kBlockSize];
+    m_high.evaluate(T, begin, end, kHigh);
+    m_low.evaluate(T, begin, end, kLow);
+
+    // 只在需要 ∂k/∂T 时计算 k∞、k0 的对数导数
+    double dHigh[kBlockSize];
+    double dLow[kBlockSize];
+    if (dkdT) {
+        m_high.logDerivative(T, begin, end, dHigh);
+        m_low.logDerivative(T, begin, end, dLow);
+    }
+
+    const bool troe = begin < m_troeCount;
+    const bool derivatives = dkdM || dkdT;
+    const Vec vT = T;
+    const Vec invT = 1.0 / T;
+    const Vec one = 1.0;
+    const Vec small = kSmallNumber;
+    const size_t count = end - begin;
+
+    // 处理 [j, j + n) 共 n 个(不超过向量宽度)反应
+    auto lanes = [&](size_t j, size_t n) {
+        auto load = [n](const double* p) { return n == simd::kWidth ? Vec::load(p) : Vec::loadPartial(p, n); };
+        auto store = [n](Vec value, double* p) {
+            if (n == simd::kWidth) value.store(p);
+            else value.storePartial(p, n);
+        };
+        Vec high = load(kHigh + j);
+        Vec low = load(kLow + j);
+        Vec pr = low * load(thirdBody + j) / (high + small);
+        Vec F = one;
+        Vec dLogFdx = 0.0;      // ∂log10 F/∂x
+        Vec dLnFdT = 0.0;       // ∂ln F/∂T, Pr 不变
+
+        if (troe) {
+            const size_t t = begin + j;
+            Vec a = load(m_troeA.data() + t);
+            Vec invT3 = load(m_troeInvT3.data() + t);
+            Vec invT1 = load(m_troeInvT1.data() + t);
+            Vec T2 = load(m_troeT2.data() + t);
+            Vec term3 = (one - a) * exp(-vT * invT3);
+            Vec term1 = a * exp(-vT * invT1);
+            Vec term2 = load(m_troeT2Weight.data() + t) * exp(-T2 * invT);
+            Vec fcent = term3 + term1 + term2;
+            Vec logFcent = log10(max(fcent, small));
+            Vec c = Vec(-0.4) - Vec(0.67) * logFcent;
+            Vec nn = Vec(0.75) - Vec(1.27) * logFcent;
+            Vec x = log10(max(pr, small)) + c;
+            Vec denominator = nn - Vec(0.14) * x;
+            Vec f1 = x / denominator;
+            Vec g = one + f1 * f1;
+            F = pow10(logFcent / g);
+
+            if (derivatives) {
+                // log10 F = L/(1+f1^2), L = log10 Fcent, ∂f1/∂x = N/d^2, ∂f1/∂L = (1.27x - 0.67N)/d^2
+                Vec common = logFcent * Vec(2.0) * f1 / (g * g * denominator * denominator);
+                dLogFdx = -common * nn;
+                Vec dLogFdL = one / g - common * (Vec(1.27) * x - Vec(0.67) * nn);
+                Vec dFcentdT = -(term3 * invT3 + term1 * invT1) + term2 * T2 * invT * invT;
+                dLnFdT = dLogFdL * dFcentdT / max(fcent, small);
+            }
+        }
+
+        Vec result = high * pr / (one + pr) * F;
+        store(result, k + j);
+        if (derivatives) {
+            Vec beta = one / (one + pr) + dLogFdx;
+            if (dkdM) store(low * F / (one + pr) * beta, dkdM + j);
+            if (dkdT) {
+                Vec dLnHigh = load(dHigh + j);
+                Vec dLnk = dLnHigh + beta * (load(dLow + j) - dLnHigh) + dLnFdT;
+                store(result * dLnk, dkdT + j);
+            }
+        }
+    };
+
+    size_t j = 0;
+    for (; j + simd::kWidth <= count; j += simd::kWidth) lanes(j, simd::kWidth);
+    if (j < count) lanes(j, count - j);
+}
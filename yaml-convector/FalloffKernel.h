@@ -0,0 +1,52 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "ArrheniusKernel.h"
+#include "CompiledKinetics.h"
+
+// ========== 批量衰减反应速率常数 ==========
+// 对 CompiledKinetics::falloff 中的全部衰减反应(Troe 在前, Lindemann 在后)计算:
+//   Pr = k0*[M]/k∞,  k = k∞ * Pr/(1+Pr) * F
+//   Lindemann: F = 1
+//   Troe: log10 F = log10 Fcent / (1 + f1^2),  f1 = (log10 Pr + C) / (N - 0.14*(log10 Pr + C)),
+//         C = -0.4 - 0.67*log10 Fcent,  N = 0.75 - 1.27*log10 Fcent
+// 与 Cantera 相同: T3、T1 为0时对应项取0, T2 为0时不含第三项; Pr、Fcent 取对数前下限为 1e-300.
+// 导数(x = log10 Pr + C):
+//   ∂k/∂[M] = k0 F/(1+Pr) β,  β = ∂ln k/∂ln Pr = 1/(1+Pr) + ∂log10 F/∂x
+//   ∂ln k/∂T = ∂ln k∞/∂T + β (∂ln k0/∂T - ∂ln k∞/∂T) + (∂log10 F/∂log10 Fcent) dFcent/dT / Fcent
+// 按固定大小的块计算, 中间结果放在栈上, 调用时不分配内存.
+class FalloffKernel {
+public:
+    FalloffKernel() = default;
+    explicit FalloffKernel(const CompiledKinetics& kinetics);
+
+    // 衰减反应数, 第 j 个衰减反应在 CompiledKinetics 中的反应下标为 reactions()[j]
+    size_t size() const { return m_reactions.size(); }
+    size_t troeCount() const { return m_troeCount; }
+    const std::vector<uint32_t>& reactions() const { return m_reactions; }
+
+    // thirdBody[j]: 第 j 个衰减反应的第三体浓度 [kmol/m^3]; 结果 k[j] 为 SI 单位
+    void evaluate(double T, const double* thirdBody, double* k) const;
+    // 同时计算导数: dkdM[j] = ∂k/∂[M], dkdT[j] = ∂k/∂T([M] 不变); 不需要的导数传 nullptr
+    void evaluate(double T, const double* thirdBody, double* k, double* dkdM, double* dkdT) const;
+    // 一批状态, 按反应存放(与 ThirdBodyMatrix 的批量结果相同): thirdBody[j * stateCount + s] -> k[j * stateCount + s]
+    void evaluate(const double* T, size_t stateCount, const double* thirdBody, double* k) const;
+
+private:
+    // 衰减反应 [begin, end), 均为同一类型; thirdBody、k、dkdM、dkdT 指向该块的第一个反应
+    void evaluateBlock(double T, size_t begin, size_t end, const double* thirdBody, double* k,
+        double* dkdM, double* dkdT) const;
+
+    ArrheniusKernel m_high;
+    ArrheniusKernel m_low;
+    std::vector<uint32_t> m_reactions;
+    size_t m_troeCount = 0;
+
+    // Troe 参数, 长度 troeCount
+    std::vector<double> m_troeA;
+    std::vector<double> m_troeInvT3;    // 1/T3, T3 为0时取 1000(对应项为0)
+    std::vector<double> m_troeInvT1;    // 1/T1, 同上
+    std::vector<double> m_troeT2;
+    std::vector<double> m_troeT2Weight; // T2 非0时为1, 否则为0
+};
@@ -0,0 +1,232 @@
+#include "KineticsEngine.h"
+#include "PhysicalConstants.h"
+#include "SimdMath.h"
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace {
+
+// exp 的参数上限, 与 Cantera 的 BigNumber(1e300)相当, 避免 K_c 溢出
+constexpr double kMaxExponent = 690.0;
+
+// 第 i 行的浓度幂次追加到 CSR: 1~3 的整数级数展开为重复的物种下标, 0 级跳过, 其余单独保存
+void appendPowers(const SparseMatrix& orders, size_t i,
+    std::vector<uint32_t>& offsets, std::vector<uint32_t>& species,
+    std::vector<uint32_t>& powerOffsets, std::vector<uint32_t>& powerSpecies, std::vector<double>& powerValues) {
+    for (uint32_t e = orders.offsets[i]; e < orders.offsets[i + 1]; e++) {
+        const uint32_t k = orders.indices[e];
+        const double order = orders.values[e];
+        if (order == 1.0 || order == 2.0 || order == 3.0) {
+            species.insert(species.end(), static_cast<size_t>(order), k);
+        }
+        else if (order != 0.0) {
+            powerSpecies.push_back(k);
+            powerValues.push_back(order);
+        }
+    }
+    offsets.push_back(static_cast<uint32_t>(species.size()));
+    powerOffsets.push_back(static_cast<uint32_t>(powerSpecies.size()));
+}
+
+// Π C_k^order
+double concentrationProduct(const double* concentrations, size_t i,
+    const std::vector<uint32_t>& offsets, const std::vector<uint32_t>& species,
+    const std::vector<uint32_t>& powerOffsets, const std::vector<uint32_t>& powerSpecies,
+    const std::vector<double>& powerValues) {
+    double product = 1.0;
+    for (uint32_t e = offsets[i]; e < offsets[i + 1]; e++) {
+        product *= concentrations[species[e]];
+    }
+    for (uint32_t e = powerOffsets[i]; e < powerOffsets[i + 1]; e++) {
+        product *= std::pow(std::max(concentrations[powerSpecies[e]], 0.0), powerValues[e]);
+    }
+    return product;
+}
+
+} // namespace
+
+KineticsEngine::KineticsEngine(const MechanismData& mechanism)
+    : m_kinetics(compileKinetics(mechanism)),
+      m_stoich(mechanism),
+      m_arrhenius(m_kinetics),
+      m_falloff(m_kinetics),
+      m_nasa7(mechanism.thermoSpecies),
+      m_nasa9(mechanism.thermoSpecies) {
+    const size_t count = reactionCount();
+    m_netByReaction = m_stoich.netBySpecies().transposed();
+
+    // 第三体矩阵: 衰减反应按 FalloffKernel 的顺序在前, 之后是三体反应
+    std::vector<uint32_t> thirdBodyRows = m_falloff.reactions();
+    for (size_t i = 0; i < count; i++) {
+        if (m_kinetics.type[i] == ReactionType::ThreeBody) thirdBodyRows.push_back(static_cast<uint32_t>(i));
+    }
+    m_thirdBody = ThirdBodyMatrix(m_kinetics, thirdBodyRows);
+
+    // 可逆反应中的物种必须有热力学数据
+    std::vector<uint8_t> hasThermo(speciesCount(), 0);
+    for (uint32_t k : m_nasa7.species()) hasThermo[k] = 1;
+    for (uint32_t k : m_nasa9.species()) hasThermo[k] = 1;
+
+    m_deltaN.resize(count);
+    m_reversible.resize(count);
+    for (size_t i = 0; i < count; i++) {
+        m_reversible[i] = m_stoich.isReversible(i) ? 1.0 : 0.0;
+        double deltaN = 0.0;
+        for (uint32_t e = m_netByReaction.offsets[i]; e < m_netByReaction.offsets[i + 1]; e++) {
+            const uint32_t k = m_netByReaction.indices[e];
+            if (m_stoich.isReversible(i) && !hasThermo[k]) {
+                throw std::runtime_error("反应 " + std::to_string(i) + ": 物种 '" + m_kinetics.speciesNames[k]
+                    + "' 没有热力学数据, 无法计算逆反应速率");
+            }
+            deltaN += m_netByReaction.values[e];
+        }
+        m_deltaN[i] = deltaN;
+    }
+
+    // 浓度幂次: 正反应取反应物化学计量数, orders 中的物种以其为准; 逆反应取产物化学计量数
+    const SparseMatrix& reactants = m_stoich.reactants();
+    const SparseMatrix& products = m_stoich.products();
+    m_forwardOrders.rows = m_reverseOrders.rows = count;
+    m_forwardOrders.cols = m_reverseOrders.cols = speciesCount();
+    m_forwardOrders.offsets.push_back(0);
+    m_reverseOrders.offsets.push_back(0);
+    std::map<uint32_t, double> orders;
+    for (size_t i = 0; i < count; i++) {
+        orders.clear();
+        for (uint32_t e = reactants.offsets[i]; e < reactants.offsets[i + 1]; e++) {
+            orders[reactants.indices[e]] = reactants.values[e];
+        }
+        for (uint32_t e = m_kinetics.orderOffsets[i]; e < m_kinetics.orderOffsets[i + 1]; e++) {
+            orders[m_kinetics.orderSpecies[e]] = m_kinetics.orderValues[e];
+        }
+        for (const auto& [k, order] : orders) {
+            m_forwardOrders.indices.push_back(k);
+            m_forwardOrders.values.push_back(order);
+        }
+        m_forwardOrders.offsets.push_back(static_cast<uint32_t>(m_forwardOrders.indices.size()));
+
+        if (m_stoich.isReversible(i)) {
+            m_reverseOrders.indices.insert(m_reverseOrders.indices.end(),
+                products.indices.begin() + products.offsets[i], products.indices.begin() + products.offsets[i + 1]);
+            m_reverseOrders.values.insert(m_reverseOrders.values.end(),
+                products.values.begin() + products.offsets[i], products.values.begin() + products.offsets[i + 1]);
+        }
+        m_reverseOrders.offsets.push_back(static_cast<uint32_t>(m_reverseOrders.indices.size()));
+    }
+
+    m_forwardOffsets.push_back(0);
+    m_forwardPowerOffsets.push_back(0);
+    m_reverseOffsets.push_back(0);
+    m_reversePowerOffsets.push_back(0);
+    for (size_t i = 0; i < count; i++) {
+        appendPowers(m_forwardOrders, i, m_forwardOffsets, m_forwardSpecies,
+            m_forwardPowerOffsets, m_forwardPowerSpecies, m_forwardPowerValues);
+        appendPowers(m_reverseOrders, i, m_reverseOffsets, m_reverseSpecies,
+            m_reversePowerOffsets, m_reversePowerSpecies, m_reversePowerValues);
+    }
+}
+
+KineticsEngine::Workspace KineticsEngine::workspace() const {
+    Workspace workspace;
+    const size_t count = reactionCount();
+    workspace.gRT.resize(speciesCount());
+    workspace.nasa7.resize(m_nasa7.size());
+    workspace.nasa9.resize(m_nasa9.size());
+    workspace.thirdBody.resize(m_thirdBody.size());
+    workspace.falloff.resize(m_falloff.size());
+    workspace.forwardConstants.resize(count);
+    workspace.reverseConstants.resize(count);
+    workspace.inverseEquilibrium.resize(count);
+    workspace.forwardRates.resize(count);
+    workspace.reverseRates.resize(count);
+    workspace.netRates.resize(count);
+    return workspace;
+}
+
+void KineticsEngine::standardGibbs(double T, Workspace& workspace) const {
+    double* gRT = workspace.gRT.data();
+    if (m_nasa7.size() > 0) {
+        m_nasa7.evaluate(T, nullptr, nullptr, nullptr, workspace.nasa7.data());
+        for (size_t j = 0; j < m_nasa7.size(); j++) gRT[m_nasa7.species()[j]] = workspace.nasa7[j];
+    }
+    if (m_nasa9.size() > 0) {
+        m_nasa9.evaluate(T, nullptr, nullptr, nullptr, workspace.nasa9.data());
+        for (size_t j = 0; j < m_nasa9.size(); j++) gRT[m_nasa9.species()[j]] = workspace.nasa9[j];
+    }
+}
+
+void KineticsEngine::standardEnthalpy(double T, Workspace& workspace, double* hRT) const {
+    std::fill(hRT, hRT + speciesCount(), 0.0);
+    if (m_nasa7.size() > 0) {
+        m_nasa7.evaluate(T, nullptr, workspace.nasa7.data(), nullptr, nullptr);
+        for (size_t j = 0; j < m_nasa7.size(); j++) hRT[m_nasa7.species()[j]] = workspace.nasa7[j];
+    }
+    if (m_nasa9.size() > 0) {
+        m_nasa9.evaluate(T, nullptr, workspace.nasa9.data(), nullptr, nullptr);
+        for (size_t j = 0; j < m_nasa9.size(); j++) hRT[m_nasa9.species()[j]] = workspace.nasa9[j];
+    }
+}
+
+void KineticsEngine::evaluate(double T, const double* concentrations, Workspace& workspace, double* wdot) const {
+    using simd::Vec;
+    const size_t count = reactionCount();
+    double* kf = workspace.forwardConstants.data();
+    double* kr = workspace.reverseConstants.data();
+
+    // 正反应速率常数; 衰减反应先得到高压限, 再由 FalloffKernel 覆盖
+    m_arrhenius.evaluate(T, kf);
+    if (m_thirdBody.size() > 0) {
+        const double* M = workspace.thirdBody.data();
+        m_thirdBody.evaluate(concentrations, workspace.thirdBody.data());
+        const size_t falloffCount = m_falloff.size();
+        if (falloffCount > 0) {
+            m_falloff.evaluate(T, M, workspace.falloff.data());
+            for (size_t j = 0; j < falloffCount; j++) kf[m_falloff.reactions()[j]] = workspace.falloff[j];
+        }
+        const auto& rows = m_thirdBody.reactions();
+        for (size_t r = falloffCount; r < rows.size(); r++) kf[rows[r]] *= M[r];
+    }
+
+    // 逆反应速率常数: 1/K_c = exp(Σν g/RT - Σν ln(P0/RT)), k_r = k_f/K_c
+    standardGibbs(T, workspace);
+    const double* gRT = workspace.gRT.data();
+    double* inverseK = workspace.inverseEquilibrium.data();
+    const double logStandardConcentration = std::log(OneAtm / (GasConstant * T));
+    for (size_t i = 0; i < count; i++) {
+        double exponent = -m_deltaN[i] * logStandardConcentration;
+        for (uint32_t e = m_netByReaction.offsets[i]; e < m_netByReaction.offsets[i + 1]; e++) {
+            exponent += m_netByReaction.values[e] * gRT[m_netByReaction.indices[e]];
+        }
+        inverseK[i] = exponent;
+    }
+    size_t i = 0;
+    for (; i + simd::kWidth <= count; i += simd::kWidth) {
+        Vec factor = Vec::load(m_reversible.data() + i) * exp(min(Vec::load(inverseK + i), Vec(kMaxExponent)));
+        factor.store(inverseK + i);
+        (Vec::load(kf + i) * factor).store(kr + i);
+    }
+    if (i < count) {
+        const size_t rest = count - i;
+        Vec factor = Vec::loadPartial(m_reversible.data() + i, rest) * exp(min(Vec::loadPartial(inverseK + i, rest), Vec(kMaxExponent)));
+        factor.storePartial(inverseK + i, rest);
+        (Vec::loadPartial(kf + i, rest) * factor).storePartial(kr + i, rest);
+    }
+
+    // 反应进度
+    double* forward = workspace.forwardRates.data();
+    double* reverse = workspace.reverseRates.data();
+    double* net = workspace.netRates.data();
+    for (size_t r = 0; r < count; r++) {
+        forward[r] = kf[r] * concentrationProduct(concentrations, r, m_forwardOffsets, m_forwardSpecies,
+            m_forwardPowerOffsets, m_forwardPowerSpecies, m_forwardPowerValues);
+        reverse[r] = kr[r] * concentrationProduct(concentrations, r, m_reverseOffsets, m_reverseSpecies,
+            m_reversePowerOffsets, m_reversePowerSpecies, m_reversePowerValues);
+        net[r] = forward[r] - reverse[r];
+    }
+
+    if (wdot) m_stoich.productionRates(net, wdot);
+}
@@ -0,0 +1,93 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "ArrheniusKernel.h"
+#include "CompiledKinetics.h"
+#include "FalloffKernel.h"
+#include "Mechanism.h"
+#include "Nasa7Thermo.h"
+#include "Nasa9Thermo.h"
+#include "StoichiometricMatrix.h"
+#include "ThirdBodyMatrix.h"
+
+// ========== 反应进度和物种净生成速率 ==========
+// 给定温度和浓度计算全部反应的正/逆反应进度和物种净生成速率(与 Cantera 的理想气体动力学相同):
+//   q_f = k_f Π_k C_k^ν'_k (orders 中给出的物种按给定级数),  q_r = k_r Π_k C_k^ν''_k
+//   三体反应 k_f 乘以 [M], 衰减反应 k_f 取 FalloffKernel 的结果
+//   k_r = k_f / K_c,  K_c = exp(-Σ_k ν_k g_k/RT) (P0/RT)^Σν_k, P0 = 1 atm; 不可逆反应 k_r = 0
+//   ω_k = Σ_r (ν''_rk - ν'_rk) (q_f - q_r)
+// 构造时编译动力学数据、化学计量矩阵和第三体矩阵, 并把每个反应的浓度幂次整理为CSR:
+// 1~3 的整数级数展开为重复的物种下标(只做乘法), 其余级数单独用 pow 计算(浓度取非负).
+// 调用时只使用 Workspace 中预先分配的数组, 不分配内存.
+class KineticsEngine {
+public:
+    // 计算所需的临时数组和中间结果, 由 workspace() 按机理大小分配一次后重复使用; 多线程时每个线程一个
+    struct Workspace {
+        std::vector<double> gRT;                // [物种] g/RT
+        std::vector<double> nasa7;              // Nasa7Thermo 输出
+        std::vector<double> nasa9;              // Nasa9Thermo 输出
+        std::vector<double> thirdBody;          // [第三体行] [M]
+        std::vector<double> falloff;            // [衰减反应] 速率常数
+
+        // 以下按反应下标, 单位为SI(kmol, m^3, s)
+        std::vector<double> forwardConstants;   // k_f, 三体反应已乘以 [M]
+        std::vector<double> reverseConstants;   // k_r
+        std::vector<double> inverseEquilibrium; // 1/K_c, 不可逆反应为0
+        std::vector<double> forwardRates;       // q_f [kmol/(m^3·s)]
+        std::vector<double> reverseRates;       // q_r
+        std::vector<double> netRates;           // q_f - q_r
+    };
+
+    KineticsEngine() = default;
+    // 物种下标取 mechanism.species; 编译失败, 或可逆反应中的物种没有 NASA7/NASA9 热力学数据时
+    // 抛出 std::runtime_error
+    explicit KineticsEngine(const MechanismData& mechanism);
+
+    size_t speciesCount() const { return m_kinetics.speciesCount; }
+    size_t reactionCount() const { return m_kinetics.reactionCount(); }
+    const CompiledKinetics& kinetics() const { return m_kinetics; }
+    const StoichiometricMatrix& stoichiometry() const { return m_stoich; }
+    // 浓度幂次(按反应, 行内物种下标升序): 正反应为反应物化学计量数或 orders 中给出的级数,
+    // 逆反应为产物化学计量数(不可逆反应为空行)
+    const SparseMatrix& forwardOrders() const { return m_forwardOrders; }
+    const SparseMatrix& reverseOrders() const { return m_reverseOrders; }
+
+    Workspace workspace() const;
+
+    // T [K], concentrations[k] [kmol/m^3]; 反应进度写入 workspace, 净生成速率写入 wdot[k]
+    // [kmol/(m^3·s)](不需要时传 nullptr)
+    void evaluate(double T, const double* concentrations, Workspace& workspace, double* wdot) const;
+
+    // 全部物种的 g/RT, 写入 workspace.gRT; 没有热力学数据的物种为0
+    void standardGibbs(double T, Workspace& workspace) const;
+    // 全部物种的 h/RT, 写入 hRT[k](使用 workspace 中的热力学临时数组); 没有热力学数据的物种为0
+    void standardEnthalpy(double T, Workspace& workspace, double* hRT) const;
+
+private:
+    CompiledKinetics m_kinetics;
+    StoichiometricMatrix m_stoich;
+    SparseMatrix m_netByReaction;           // ν''-ν', 按反应
+    SparseMatrix m_forwardOrders;
+    SparseMatrix m_reverseOrders;
+    ArrheniusKernel m_arrhenius;
+    FalloffKernel m_falloff;
+    ThirdBodyMatrix m_thirdBody;            // 前 m_falloff.size() 行与衰减反应一一对应, 之后是三体反应
+    Nasa7Thermo m_nasa7;
+    Nasa9Thermo m_nasa9;
+
+    std::vector<double> m_deltaN;           // Σν, 按反应
+    std::vector<double> m_reversible;       // 可逆为1, 否则为0
+
+    // 浓度幂次, 按反应: 单位级数展开后的物种下标, 以及其余级数的 (物种, 级数)
+    std::vector<uint32_t> m_forwardOffsets;
+    std::vector<uint32_t> m_forwardSpecies;
+    std::vector<uint32_t> m_forwardPowerOffsets;
+    std::vector<uint32_t> m_forwardPowerSpecies;
+    std::vector<double> m_forwardPowerValues;
+    std::vector<uint32_t> m_reverseOffsets;
+    std::vector<uint32_t> m_reverseSpecies;
+    std::vector<uint32_t> m_reversePowerOffsets;
+    std::vector<uint32_t> m_reversePowerSpecies;
+    std::vector<double> m_reversePowerValues;
+};
@@ -0,0 +1,278 @@
+#include "KineticsJacobian.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+constexpr uint32_t kNoColumn = std::numeric_limits<uint32_t>::max();
+// 分数级数求导时浓度的下限, 避免 C^(n-1) 在 C = 0 处为无穷(与 Cantera 的 SmallNumber 相同)
+constexpr double kSmallConcentration = 1e-300;
+
+// C^order, 与 KineticsEngine 一致: 1~3 级直接相乘, 其余浓度取非负
+double power(double c, double order) {
+    if (order == 1.0) return c;
+    if (order == 2.0) return c * c;
+    if (order == 3.0) return c * c * c;
+    if (order == 0.0) return 1.0;
+    return std::pow(std::max(c, 0.0), order);
+}
+
+// d(C^order)/dC
+double powerDerivative(double c, double order) {
+    if (order == 1.0) return 1.0;
+    if (order == 2.0) return 2.0 * c;
+    if (order == 3.0) return 3.0 * c * c;
+    if (order == 0.0) return 0.0;
+    return order * std::pow(std::max(c, kSmallConcentration), order - 1.0);
+}
+
+// 第 i 行各项对 gradient 的贡献: scale * ∂(Π C^order)/∂C, 返回 Π C^order
+double addProductGradient(const SparseMatrix& orders, size_t i, const std::vector<uint32_t>& local,
+    const double* concentrations, double scale, double* gradient) {
+    const uint32_t begin = orders.offsets[i];
+    const uint32_t end = orders.offsets[i + 1];
+    double product = 1.0;
+    for (uint32_t e = begin; e < end; e++) product *= power(concentrations[orders.indices[e]], orders.values[e]);
+    if (scale == 0.0) return product;
+
+    // 每行只有几项, 直接对其余各项求积(浓度可以为0, 不能用 product / C^order)
+    for (uint32_t e = begin; e < end; e++) {
+        double derivative = scale * powerDerivative(concentrations[orders.indices[e]], orders.values[e]);
+        for (uint32_t f = begin; f < end; f++) {
+            if (f != e) derivative *= power(concentrations[orders.indices[f]], orders.values[f]);
+        }
+        gradient[local[e]] += derivative;
+    }
+    return product;
+}
+
+// 依赖列 columns 中列 c 的位置
+uint32_t localColumn(const uint32_t* columns, size_t count, uint32_t c) {
+    return static_cast<uint32_t>(std::lower_bound(columns, columns + count, c) - columns);
+}
+
+} // namespace
+
+KineticsJacobian::KineticsJacobian(const KineticsEngine& engine, bool thirdBodies)
+    : m_engine(engine),
+      m_arrhenius(engine.kinetics()),
+      m_falloff(engine.kinetics()),
+      m_thirdBodies(thirdBodies) {
+    const CompiledKinetics& kinetics = m_engine.kinetics();
+    const SparseMatrix& forward = m_engine.forwardOrders();
+    const SparseMatrix& reverse = m_engine.reverseOrders();
+    const size_t species = size();
+    const size_t reactions = m_engine.reactionCount();
+    const uint32_t temperatureColumn = static_cast<uint32_t>(species);
+
+    m_netByReaction = m_engine.stoichiometry().netBySpecies().transposed();
+    m_falloffIndex.assign(reactions, -1);
+    for (size_t j = 0; j < m_falloff.size(); j++) m_falloffIndex[m_falloff.reactions()[j]] = static_cast<int32_t>(j);
+    m_defaultEfficiency.resize(reactions);
+    m_deltaN.resize(reactions);
+    for (size_t r = 0; r < reactions; r++) {
+        m_defaultEfficiency[r] = thirdBodies ? kinetics.defaultEfficiency[r] : 0.0;
+        double deltaN = 0.0;
+        for (uint32_t e = m_netByReaction.offsets[r]; e < m_netByReaction.offsets[r + 1]; e++) {
+            deltaN += m_netByReaction.values[e];
+        }
+        m_deltaN[r] = deltaN;
+    }
+
+    // 依赖列: 正/逆反应的浓度幂次, 效率与默认值不同的第三体物种, 温度
+    m_dependencyOffsets.push_back(0);
+    std::vector<uint32_t> columns;
+    for (size_t r = 0; r < reactions; r++) {
+        columns.clear();
+        columns.insert(columns.end(), forward.indices.begin() + forward.offsets[r], forward.indices.begin() + forward.offsets[r + 1]);
+        columns.insert(columns.end(), reverse.indices.begin() + reverse.offsets[r], reverse.indices.begin() + reverse.offsets[r + 1]);
+        if (thirdBodies) {
+            for (uint32_t e = kinetics.efficiencyOffsets[r]; e < kinetics.efficiencyOffsets[r + 1]; e++) {
+                if (kinetics.efficiencyValues[e] != kinetics.defaultEfficiency[r]) columns.push_back(kinetics.efficiencySpecies[e]);
+            }
+        }
+        std::sort(columns.begin(), columns.end());
+        columns.erase(std::unique(columns.begin(), columns.end()), columns.end());
+        columns.push_back(temperatureColumn);
+        m_dependencyColumns.insert(m_dependencyColumns.end(), columns.begin(), columns.end());
+        m_dependencyOffsets.push_back(static_cast<uint32_t>(m_dependencyColumns.size()));
+    }
+
+    auto dependencies = [&](size_t r) { return m_dependencyColumns.data() + m_dependencyOffsets[r]; };
+    auto dependencyCount = [&](size_t r) { return static_cast<size_t>(m_dependencyOffsets[r + 1] - m_dependencyOffsets[r]); };
+
+    m_forwardLocal.resize(forward.nonZeros());
+    m_reverseLocal.resize(reverse.nonZeros());
+    m_efficiencyLocal.assign(kinetics.efficiencySpecies.size(), kNoColumn);
+    for (size_t r = 0; r < reactions; r++) {
+        for (uint32_t e = forward.offsets[r]; e < forward.offsets[r + 1]; e++) {
+            m_forwardLocal[e] = localColumn(dependencies(r), dependencyCount(r), forward.indices[e]);
+        }
+        for (uint32_t e = reverse.offsets[r]; e < reverse.offsets[r + 1]; e++) {
+            m_reverseLocal[e] = localColumn(dependencies(r), dependencyCount(r), reverse.indices[e]);
+        }
+        if (!thirdBodies) continue;
+        for (uint32_t e = kinetics.efficiencyOffsets[r]; e < kinetics.efficiencyOffsets[r + 1]; e++) {
+            if (kinetics.efficiencyValues[e] != kinetics.defaultEfficiency[r]) {
+                m_efficiencyLocal[e] = localColumn(dependencies(r), dependencyCount(r), kinetics.efficiencySpecies[e]);
+            }
+        }
+    }
+
+    // 稀疏结构: 第 k 行为物种 k 参与(净化学计量数不为0)的反应的依赖列之并
+    const SparseMatrix& bySpecies = m_engine.stoichiometry().netBySpecies();
+    std::vector<uint32_t> mark(species + 1, kNoColumn);
+    m_offsets.push_back(0);
+    for (size_t k = 0; k < species; k++) {
+        bool dense = false;
+        const size_t rowBegin = m_indices.size();
+        for (uint32_t e = bySpecies.offsets[k]; e < bySpecies.offsets[k + 1]; e++) {
+            const uint32_t r = bySpecies.indices[e];
+            dense |= m_defaultEfficiency[r] != 0.0;
+            for (size_t b = 0; b < dependencyCount(r); b++) {
+                const uint32_t c = dependencies(r)[b];
+                if (mark[c] != k) {
+                    mark[c] = static_cast<uint32_t>(k);
+                    m_indices.push_back(c);
+                }
+            }
+        }
+        if (dense) {
+            m_indices.resize(rowBegin);
+            for (uint32_t c = 0; c <= temperatureColumn; c++) m_indices.push_back(c);
+            m_denseRows.push_back(static_cast<uint32_t>(k));
+        }
+        else {
+            std::sort(m_indices.begin() + rowBegin, m_indices.end());
+        }
+        if (m_indices.size() > std::numeric_limits<uint32_t>::max()) {
+            throw std::runtime_error("KineticsJacobian: 非零元超过 uint32 范围");
+        }
+        m_offsets.push_back(static_cast<uint32_t>(m_indices.size()));
+    }
+
+    // 每个反应的 (净物种, 依赖列) 在 values 中的位置
+    m_scatterOffsets.push_back(0);
+    for (size_t r = 0; r < reactions; r++) {
+        for (uint32_t e = m_netByReaction.offsets[r]; e < m_netByReaction.offsets[r + 1]; e++) {
+            const uint32_t k = m_netByReaction.indices[e];
+            const uint32_t* row = m_indices.data() + m_offsets[k];
+            const size_t rowLength = m_offsets[k + 1] - m_offsets[k];
+            for (size_t b = 0; b < dependencyCount(r); b++) {
+                m_scatter.push_back(m_offsets[k] + localColumn(row, rowLength, dependencies(r)[b]));
+            }
+        }
+        m_scatterOffsets.push_back(static_cast<uint32_t>(m_scatter.size()));
+    }
+}
+
+KineticsJacobian::Workspace KineticsJacobian::workspace() const {
+    Workspace workspace;
+    workspace.kinetics = m_engine.workspace();
+    workspace.hRT.resize(size());
+    workspace.arrhenius.resize(m_engine.reactionCount());
+    workspace.dlogkdT.resize(m_engine.reactionCount());
+    workspace.falloff.resize(m_falloff.size());
+    workspace.falloffdkdM.resize(m_falloff.size());
+    workspace.falloffdkdT.resize(m_falloff.size());
+    size_t longest = 0;
+    for (size_t r = 0; r < m_engine.reactionCount(); r++) {
+        longest = std::max<size_t>(longest, m_dependencyOffsets[r + 1] - m_dependencyOffsets[r]);
+    }
+    workspace.gradient.resize(longest);
+    workspace.thirdBody.resize(size());
+    return workspace;
+}
+
+void KineticsJacobian::evaluate(double T, const double* concentrations, Workspace& workspace, double* values,
+    double* wdot) const {
+    const CompiledKinetics& kinetics = m_engine.kinetics();
+    const SparseMatrix& forward = m_engine.forwardOrders();
+    const SparseMatrix& reverse = m_engine.reverseOrders();
+    const size_t reactions = m_engine.reactionCount();
+    KineticsEngine::Workspace& rates = workspace.kinetics;
+
+    // 速率常数、[M] 和 1/K_c 由 KineticsEngine 计算
+    m_engine.evaluate(T, concentrations, rates, wdot);
+    m_engine.standardEnthalpy(T, rates, workspace.hRT.data());
+    m_arrhenius.evaluate(T, workspace.arrhenius.data());
+    m_arrhenius.logDerivative(T, 0, reactions, workspace.dlogkdT.data());
+    if (m_falloff.size() > 0) {
+        // 第三体行的前 m_falloff.size() 行即衰减反应的 [M]
+        m_falloff.evaluate(T, rates.thirdBody.data(), workspace.falloff.data(),
+            workspace.falloffdkdM.data(), workspace.falloffdkdT.data());
+    }
+
+    std::fill(values, values + nonZeros(), 0.0);
+    std::fill(workspace.thirdBody.begin(), workspace.thirdBody.end(), 0.0);
+    const double* hRT = workspace.hRT.data();
+    double* gradient = workspace.gradient.data();
+
+    for (size_t r = 0; r < reactions; r++) {
+        const size_t count = m_dependencyOffsets[r + 1] - m_dependencyOffsets[r];
+        std::fill(gradient, gradient + count, 0.0);
+
+        const double kf = rates.forwardConstants[r];
+        const double kr = rates.reverseConstants[r];
+        const double forwardProduct = addProductGradient(forward, r, m_forwardLocal, concentrations, kf, gradient);
+        const double reverseProduct = addProductGradient(reverse, r, m_reverseLocal, concentrations, -kr, gradient);
+        const double driving = forwardProduct - rates.inverseEquilibrium[r] * reverseProduct;
+
+        // 第三体: ∂q/∂[M] 分给效率与默认值不同的物种, 默认效率部分按物种累加
+        const int32_t falloff = m_falloffIndex[r];
+        double dkfdT = kf * workspace.dlogkdT[r];
+        if (kinetics.type[r] != ReactionType::Elementary) {
+            double dqdM = 0.0;
+            if (falloff >= 0) {
+                dqdM = workspace.falloffdkdM[falloff] * driving;
+                dkfdT = workspace.falloffdkdT[falloff];
+            }
+            else {
+                dqdM = workspace.arrhenius[r] * driving;
+            }
+            if (m_thirdBodies) {
+                const double defaultEfficiency = kinetics.defaultEfficiency[r];
+                for (uint32_t e = kinetics.efficiencyOffsets[r]; e < kinetics.efficiencyOffsets[r + 1]; e++) {
+                    if (m_efficiencyLocal[e] != kNoColumn) {
+                        gradient[m_efficiencyLocal[e]] += (kinetics.efficiencyValues[e] - defaultEfficiency) * dqdM;
+                    }
+                }
+                if (defaultEfficiency != 0.0) {
+                    for (uint32_t e = m_netByReaction.offsets[r]; e < m_netByReaction.offsets[r + 1]; e++) {
+                        workspace.thirdBody[m_netByReaction.indices[e]] += m_netByReaction.values[e] * defaultEfficiency * dqdM;
+                    }
+                }
+            }
+        }
+
+        // 温度列: d(ln K_c)/dT = (Σν h/RT - Σν) / T
+        double dlogKdT = 0.0;
+        if (rates.reverseRates[r] != 0.0) {
+            double sum = -m_deltaN[r];
+            for (uint32_t e = m_netByReaction.offsets[r]; e < m_netByReaction.offsets[r + 1]; e++) {
+                sum += m_netByReaction.values[e] * hRT[m_netByReaction.indices[e]];
+            }
+            dlogKdT = sum / T;
+        }
+        gradient[count - 1] = dkfdT * driving + rates.reverseRates[r] * dlogKdT;
+
+        // 分散到物种行
+        const uint32_t* scatter = m_scatter.data() + m_scatterOffsets[r];
+        for (uint32_t e = m_netByReaction.offsets[r]; e < m_netByReaction.offsets[r + 1]; e++) {
+            const double nu = m_netByReaction.values[e];
+            for (size_t b = 0; b < count; b++) values[scatter[b]] += nu * gradient[b];
+            scatter += count;
+        }
+    }
+
+    // 默认效率部分: 整行的浓度列(不含最后的温度列)
+    for (uint32_t k : m_denseRows) {
+        const double value = workspace.thirdBody[k];
+        if (value == 0.0) continue;
+        double* row = values + m_offsets[k];
+        const size_t length = m_offsets[k + 1] - m_offsets[k] - 1;
+        for (size_t c = 0; c < length; c++) row[c] += value;
+    }
+}
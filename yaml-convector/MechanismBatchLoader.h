@@ -0,0 +1,31 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "Mechanism.h"
+
+// 批量加载中单个文件的结果
+struct BatchLoadResult {
+    std::string file;
+    MechanismData mechanism;
+    bool success = false;
+    std::string error;          // 失败原因(读取或解析错误), 成功时为空
+    bool fromCache = false;     // 是否命中二进制缓存(见 MechanismCache.h)
+
+    // 各阶段耗时(毫秒)
+    double readMs = 0.0;        // 读取文件
+    double parseMs = 0.0;       // YAML解析(命中缓存时为读取缓存)
+    double extractMs = 0.0;     // 提取机理数据
+    double totalMs = 0.0;
+};
+
+// 加载单个文件(读取、YamlDocument 解析、提取), loadMechanisms 的每个任务即调用此函数.
+// 所有错误都记录在结果中, 不抛出异常; useCache 含义与 loadMechanism 相同
+BatchLoadResult loadMechanismFile(const std::string& file, bool useCache = false);
+
+// 在线程池上并发加载多个机理文件, 每个工作线程依次完成读取、解析和提取,
+// 因此一个文件的读取与其他文件的解析和提取相互重叠.
+// 返回结果与 files 顺序一致; 单个文件失败不影响其他文件.
+// threads 为0时使用全部硬件线程; useCache 含义与 loadMechanism 相同(默认不使用).
+// 使用缓存时相同路径只加载一次, 结果复制到重复的位置, 避免多个线程同时写同一缓存
+std::vector<BatchLoadResult> loadMechanisms(const std::vector<std::string>& files, size_t threads = 0,
+    bool verbose = false, bool useCache = false);
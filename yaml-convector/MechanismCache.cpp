@@ -0,0 +1,298 @@
+#include "MechanismCache.h"
+#include "AtomicFile.h"
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace {
+
+const char kCacheMagic[8] = { 'Y', 'C', 'M', 'E', 'C', 'H', 'D', 'B' };
+constexpr uint32_t kByteOrderMark = 0x01020304;
+
+// 顺序写入缓冲区
+class CacheWriter {
+public:
+    template <typename T>
+    void pod(const T& value) {
+        const char* bytes = reinterpret_cast<const char*>(&value);
+        m_buffer.append(bytes, sizeof(T));
+    }
+
+    void count(size_t n) {
+        if (n > UINT32_MAX) {
+            throw std::runtime_error("mechanism too large for cache");
+        }
+        pod(static_cast<uint32_t>(n));
+    }
+
+    void string(const std::string& value) {
+        count(value.size());
+        m_buffer.append(value);
+    }
+
+    void numbers(const std::vector<double>& values) {
+        count(values.size());
+        m_buffer.append(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(double));
+    }
+
+    void map(const std::map<std::string, double>& values) {
+        count(values.size());
+        for (const auto& [key, value] : values) {
+            string(key);
+            pod(value);
+        }
+    }
+
+    const std::string& buffer() const { return m_buffer; }
+
+private:
+    std::string m_buffer;
+};
+
+// 顺序读取缓冲区, 越界时抛出 std::runtime_error
+class CacheReader {
+public:
+    CacheReader(const char* data, size_t size) : m_data(data), m_size(size) {}
+
+    template <typename T>
+    T pod() {
+        T value;
+        std::memcpy(&value, take(sizeof(T)), sizeof(T));
+        return value;
+    }
+
+    // 每个元素至少占1字节, 条数超过剩余字节数说明缓存已损坏
+    size_t count() {
+        size_t n = pod<uint32_t>();
+        if (n > m_size - m_pos) {
+            throw std::runtime_error("corrupted mechanism cache");
+        }
+        return n;
+    }
+
+    void string(std::string& value) {
+        size_t n = count();
+        value.assign(take(n), n);
+    }
+
+    void numbers(std::vector<double>& values) {
+        size_t n = count();
+        const char* bytes = take(n * sizeof(double));
+        values.resize(n);
+        std::memcpy(values.data(), bytes, n * sizeof(double));
+    }
+
+    void map(std::map<std::string, double>& values) {
+        size_t n = count();
+        values.clear();
+        std::string key;
+        for (size_t i = 0; i < n; i++) {
+            string(key);
+            double value = pod<double>();
+            values.emplace_hint(values.end(), key, value);
+        }
+    }
+
+    bool atEnd() const { return m_pos == m_size; }
+
+private:
+    const char* take(size_t n) {
+        if (n > m_size - m_pos) {
+            throw std::runtime_error("truncated mechanism cache");
+        }
+        const char* p = m_data + m_pos;
+        m_pos += n;
+        return p;
+    }
+
+    const char* m_data;
+    size_t m_size;
+    size_t m_pos = 0;
+};
+
+void writeReaction(CacheWriter& out, const ReactionData& reaction) {
+    out.string(reaction.equation);
+    out.string(reaction.type);
+    out.pod(reaction.rateConstant.A);
+    out.string(reaction.rateConstant.A_units);
+    out.pod(reaction.rateConstant.b);
+    out.pod(reaction.rateConstant.Ea);
+    out.string(reaction.rateConstant.Ea_units);
+    out.map(reaction.efficiencies);
+    out.pod(reaction.lowPressure.A);
+    out.pod(reaction.lowPressure.b);
+    out.pod(reaction.lowPressure.Ea);
+    out.pod(reaction.troe.a);
+    out.pod(reaction.troe.T_star);
+    out.pod(reaction.troe.T_double_star);
+    out.pod(reaction.troe.T_triple_star);
+    out.string(reaction.falloffForm);
+    out.pod(static_cast<uint8_t>(reaction.isDuplicate ? 1 : 0));
+    out.map(reaction.orders);
+}
+
+void readReaction(CacheReader& in, ReactionData& reaction) {
+    in.string(reaction.equation);
+    in.string(reaction.type);
+    reaction.rateConstant.A = in.pod<double>();
+    in.string(reaction.rateConstant.A_units);
+    reaction.rateConstant.b = in.pod<double>();
+    reaction.rateConstant.Ea = in.pod<double>();
+    in.string(reaction.rateConstant.Ea_units);
+    in.map(reaction.efficiencies);
+    reaction.lowPressure.A = in.pod<double>();
+    reaction.lowPressure.b = in.pod<double>();
+    reaction.lowPressure.Ea = in.pod<double>();
+    reaction.troe.a = in.pod<double>();
+    reaction.troe.T_star = in.pod<double>();
+    reaction.troe.T_double_star = in.pod<double>();
+    reaction.troe.T_triple_star = in.pod<double>();
+    in.string(reaction.falloffForm);
+    reaction.isDuplicate = in.pod<uint8_t>() != 0;
+    in.map(reaction.orders);
+}
+
+void writeThermo(CacheWriter& out, const ThermoData& thermo) {
+    out.string(thermo.name);
+    out.map(thermo.composition);
+    out.string(thermo.model);
+    out.numbers(thermo.temperatureRanges);
+    out.numbers(thermo.coefficients.low);
+    out.numbers(thermo.coefficients.high);
+    out.count(thermo.nasa9Coeffs.size());
+    for (const auto& range : thermo.nasa9Coeffs) {
+        out.numbers(range.temperatureRange);
+        out.numbers(range.coefficients);
+    }
+}
+
+void readThermo(CacheReader& in, ThermoData& thermo) {
+    in.string(thermo.name);
+    in.map(thermo.composition);
+    in.string(thermo.model);
+    in.numbers(thermo.temperatureRanges);
+    in.numbers(thermo.coefficients.low);
+    in.numbers(thermo.coefficients.high);
+    thermo.nasa9Coeffs.resize(in.count());
+    for (auto& range : thermo.nasa9Coeffs) {
+        in.numbers(range.temperatureRange);
+        in.numbers(range.coefficients);
+    }
+}
+
+void writeTransport(CacheWriter& out, const TransportData& transport) {
+    out.string(transport.name);
+    out.string(transport.model);
+    out.string(transport.geometry);
+    out.pod(transport.diameter);
+    out.pod(transport.wellDepth);
+    out.pod(transport.dipole);
+    out.pod(transport.polarizability);
+    out.pod(transport.rotationalRelaxation);
+    out.string(transport.note);
+}
+
+void readTransport(CacheReader& in, TransportData& transport) {
+    in.string(transport.name);
+    in.string(transport.model);
+    in.string(transport.geometry);
+    transport.diameter = in.pod<double>();
+    transport.wellDepth = in.pod<double>();
+    transport.dipole = in.pod<double>();
+    transport.polarizability = in.pod<double>();
+    transport.rotationalRelaxation = in.pod<double>();
+    in.string(transport.note);
+}
+
+} // namespace
+
+uint64_t hashMechanismSource(const std::string& content) {
+    const uint64_t prime = 0x100000001b3ULL;
+    uint64_t hash = 0xcbf29ce484222325ULL;
+
+    size_t i = 0;
+    for (; i + 8 <= content.size(); i += 8) {
+        uint64_t word;
+        std::memcpy(&word, content.data() + i, sizeof(word));
+        hash = (hash ^ word) * prime;
+    }
+    for (; i < content.size(); i++) {
+        hash = (hash ^ static_cast<unsigned char>(content[i])) * prime;
+    }
+    // 长度也计入哈希, 避免末尾补零的内容发生碰撞
+    hash = (hash ^ content.size()) * prime;
+    return hash;
+}
+
+std::string mechanismCachePath(const std::string& yamlFile) {
+    return yamlFile + ".mechcache";
+}
+
+void writeMechanismCache(const std::string& cacheFile, const MechanismData& mechanism, uint64_t sourceHash) {
+    CacheWriter out;
+    for (char c : kCacheMagic) out.pod(c);
+    out.pod(kMechanismCacheVersion);
+    out.pod(kByteOrderMark);
+    out.pod(sourceHash);
+
+    out.string(mechanism.units.length);
+    out.string(mechanism.units.time);
+    out.string(mechanism.units.quantity);
+    out.string(mechanism.units.activationEnergy);
+
+    out.count(mechanism.reactions.size());
+    for (const auto& reaction : mechanism.reactions) writeReaction(out, reaction);
+    out.count(mechanism.thermoSpecies.size());
+    for (const auto& thermo : mechanism.thermoSpecies) writeThermo(out, thermo);
+    out.count(mechanism.transportSpecies.size());
+    for (const auto& transport : mechanism.transportSpecies) writeTransport(out, transport);
+
+    // 先写唯一命名的临时文件再原子替换, 其他进程和线程不会读到写了一半的缓存, 也不会找不到缓存
+    if (!writeFileAtomically(cacheFile, out.buffer().data(), out.buffer().size())) {
+        throw std::runtime_error("cannot write mechanism cache: " + cacheFile);
+    }
+}
+
+bool readMechanismCache(const std::string& cacheFile, uint64_t sourceHash, MechanismData& mechanism) {
+    std::ifstream input(cacheFile, std::ios::binary | std::ios::ate);
+    if (!input) {
+        return false;
+    }
+    std::string buffer(static_cast<size_t>(input.tellg()), '\0');
+    input.seekg(0);
+    if (!input.read(&buffer[0], static_cast<std::streamsize>(buffer.size()))) {
+        return false;
+    }
+
+    try {
+        CacheReader in(buffer.data(), buffer.size());
+        for (char c : kCacheMagic) {
+            if (in.pod<char>() != c) return false;
+        }
+        if (in.pod<uint32_t>() != kMechanismCacheVersion) return false;
+        if (in.pod<uint32_t>() != kByteOrderMark) return false;
+        if (in.pod<uint64_t>() != sourceHash) return false;
+
+        MechanismData result;
+        in.string(result.units.length);
+        in.string(result.units.time);
+        in.string(result.units.quantity);
+        in.string(result.units.activationEnergy);
+
+        result.reactions.resize(in.count());
+        for (auto& reaction : result.reactions) readReaction(in, reaction);
+        result.thermoSpecies.resize(in.count());
+        for (auto& thermo : result.thermoSpecies) readThermo(in, thermo);
+        result.transportSpecies.resize(in.count());
+        for (auto& transport : result.transportSpecies) readTransport(in, transport);
+
+        if (!in.atEnd()) return false;
+        indexSpecies(result);
+        mechanism = std::move(result);
+        return true;
+    }
+    catch (const std::exception&) {
+        // 缓存损坏: 按未命中处理, 由调用方重建
+        return false;
+    }
+}
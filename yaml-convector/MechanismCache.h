@@ -0,0 +1,27 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include "Mechanism.h"
+
+// ========== MechanismData 二进制缓存 ==========
+// 文件格式(本机字节序):
+//   文件头: 魔数"YCMECHDB"(8字节) | 格式版本(uint32) | 字节序标记(uint32) | 源YAML内容哈希(uint64)
+//   正文:   单位 | 反应 | 热力学物种 | 输运物种, 后三段先写 uint32 条数, 再逐条写出所有字段
+//   字符串写 uint32 长度 + 字节, map 写 uint32 条数 + (字符串, double), vector<double> 写 uint32 长度 + 数组
+// ReactionData/ThermoData/TransportData 的字段有变化时必须增加版本号, 旧缓存会被自动重建
+
+// 版本2: 增加 MechanismData::units, 提取时支持 high-P-rate-constant
+// 版本3: 增加 ReactionData::falloffForm
+constexpr uint32_t kMechanismCacheVersion = 3;
+
+// 源文件内容哈希(64位 FNV-1a, 按8字节分块)
+uint64_t hashMechanismSource(const std::string& content);
+
+// 缓存文件路径: 源文件路径 + ".mechcache"
+std::string mechanismCachePath(const std::string& yamlFile);
+
+// 写入缓存(先写唯一命名的临时文件再原子替换, 见 AtomicFile.h), 失败时抛出 std::runtime_error
+void writeMechanismCache(const std::string& cacheFile, const MechanismData& mechanism, uint64_t sourceHash);
+
+// 读取缓存: 文件不存在、版本或哈希不匹配、内容损坏时返回 false, mechanism 保持不变
+bool readMechanismCache(const std::string& cacheFile, uint64_t sourceHash, MechanismData& mechanism);
@@ -0,0 +1,306 @@
+#include "MechanismStreamLoader.h"
+#include <fstream>
+#include <iostream>
+#include <yaml-cpp/parser.h>
+
+namespace {
+
+// 根据解析事件定位 reactions/species 记录, 把记录事件转发给 YamlNodeBuilder,
+// 记录构建完成后立即提取并丢弃
+class MechanismEventHandler : public YAML::EventHandler {
+public:
+    MechanismEventHandler(MechanismData& mechanism, bool verbose)
+        : m_mechanism(mechanism), m_verbose(verbose) {}
+
+    void OnDocumentStart(const YAML::Mark&) override {}
+    void OnDocumentEnd() override {}
+
+    void OnNull(const YAML::Mark& mark, YAML::anchor_t anchor) override {
+        if (forward(anchor)) {
+            m_builder.OnNull(mark, anchor);
+            finishRecord();
+            return;
+        }
+        onScalarEvent(std::string());
+    }
+
+    void OnAlias(const YAML::Mark& mark, YAML::anchor_t anchor) override {
+        if (forward(YAML::NullAnchor)) {
+            m_builder.OnAlias(mark, anchor);
+            finishRecord();
+            return;
+        }
+        onScalarEvent(std::string());
+    }
+
+    void OnScalar(const YAML::Mark& mark, const std::string& tag,
+        YAML::anchor_t anchor, const std::string& value) override {
+        if (forward(anchor)) {
+            m_builder.OnScalar(mark, tag, anchor, value);
+            finishRecord();
+            return;
+        }
+        onScalarEvent(value);
+    }
+
+    void OnSequenceStart(const YAML::Mark& mark, const std::string& tag,
+        YAML::anchor_t anchor, YAML::EmitterStyle::value style) override {
+        if (forward(anchor)) {
+            m_builder.OnSequenceStart(mark, tag, anchor, style);
+            return;
+        }
+        onContainerStart(true);
+    }
+
+    void OnSequenceEnd() override {
+        if (building()) {
+            m_builder.OnSequenceEnd();
+            finishRecord();
+            return;
+        }
+        onContainerEnd();
+    }
+
+    void OnMapStart(const YAML::Mark& mark, const std::string& tag,
+        YAML::anchor_t anchor, YAML::EmitterStyle::value style) override {
+        if (forward(anchor)) {
+            m_builder.OnMapStart(mark, tag, anchor, style);
+            return;
+        }
+        onContainerStart(false);
+    }
+
+    void OnMapEnd() override {
+        if (building()) {
+            m_builder.OnMapEnd();
+            finishRecord();
+            return;
+        }
+        onContainerEnd();
+    }
+
+private:
+    enum class State {
+        Start,      // 等待根节点
+        RootKey,    // 根映射表中等待键
+        RootValue,  // 根映射表中等待值
+        Skip,       // 跳过不需要的根节点值
+        List,       // reactions/species 序列中等待下一条记录
+        Record,     // 正在构建一条记录
+        Capture,    // 正在构建 units 或带锚点的根节点值(供后续别名引用)
+        Done
+    };
+
+    enum class Section { None, Reactions, Species };
+
+    bool building() const {
+        return m_state == State::Record || m_state == State::Capture;
+    }
+
+    // 当前事件是否需要转发给构建器(序列中的新记录、带锚点的根节点值都从这里开始)
+    bool forward(YAML::anchor_t anchor) {
+        if (m_state == State::List) {
+            m_state = State::Record;
+        }
+        else if (m_state == State::RootValue && m_key != "reactions" && m_key != "species"
+            && (anchor != YAML::NullAnchor || m_key == "units")) {
+            m_state = State::Capture;
+        }
+        return building();
+    }
+
+    void onScalarEvent(const std::string& value) {
+        switch (m_state) {
+        case State::Start:
+            std::cerr << "错误: YAML根节点必须是映射表类型" << std::endl;
+            m_state = State::Done;
+            break;
+        case State::RootKey:
+            m_key = value;
+            m_state = State::RootValue;
+            break;
+        case State::RootValue:
+            m_state = State::RootKey;
+            break;
+        default:
+            break;
+        }
+    }
+
+    void onContainerStart(bool isSequence) {
+        switch (m_state) {
+        case State::Start:
+            if (isSequence) {
+                std::cerr << "错误: YAML根节点必须是映射表类型" << std::endl;
+                m_state = State::Skip;
+                m_skipDepth = 1;
+                m_skipReturn = State::Done;
+            }
+            else {
+                m_state = State::RootKey;
+            }
+            break;
+        case State::RootValue:
+            if (isSequence && (m_key == "reactions" || m_key == "species")) {
+                m_section = (m_key == "reactions") ? Section::Reactions : Section::Species;
+                m_index = 0;
+                m_state = State::List;
+                break;
+            }
+            m_state = State::Skip;
+            m_skipDepth = 1;
+            m_skipReturn = State::RootKey;
+            break;
+        case State::RootKey:
+            // 复杂键: 跳过键本身, 之后的值也不会被使用
+            m_key.clear();
+            m_state = State::Skip;
+            m_skipDepth = 1;
+            m_skipReturn = State::RootValue;
+            break;
+        case State::Skip:
+            m_skipDepth++;
+            break;
+        default:
+            break;
+        }
+    }
+
+    void onContainerEnd() {
+        switch (m_state) {
+        case State::Skip:
+            if (--m_skipDepth == 0) {
+                m_state = m_skipReturn;
+            }
+            break;
+        case State::List:
+            if (m_verbose) {
+                if (m_section == Section::Reactions) {
+                    std::cout << "找到 " << m_index << " 个反应" << std::endl;
+                }
+                else {
+                    std::cout << "找到 " << m_index << " 个物种" << std::endl;
+                }
+            }
+            m_section = Section::None;
+            m_state = State::RootKey;
+            break;
+        case State::RootKey:
+            m_state = State::Done;
+            break;
+        default:
+            break;
+        }
+    }
+
+    // 记录构建完成时提取数据并释放记录
+    void finishRecord() {
+        if (!m_builder.done()) return;
+
+        if (m_state == State::Capture) {
+            // 锚点已由构建器记录, 除 units 外值本身不需要
+            YamlValue value = m_builder.take();
+            if (m_key == "units") {
+                extractUnits(value, m_mechanism.units);
+            }
+            m_state = State::RootKey;
+            return;
+        }
+
+        YamlValue record = m_builder.take();
+        size_t i = m_index++;
+        m_state = State::List;
+
+        if (m_section == Section::Reactions) {
+            try {
+                ReactionData reactionItem;
+                if (extractReaction(record, i, reactionItem, m_verbose)) {
+                    m_mechanism.reactions.push_back(std::move(reactionItem));
+                }
+            }
+            catch (const std::exception& e) {
+                if (m_verbose) {
+                    std::cerr << "处理反应 #" << (i + 1) << " 时出错: " << e.what() << std::endl;
+                    std::cerr << "继续处理下一个反应..." << std::endl;
+                }
+            }
+            return;
+        }
+
+        try {
+            ThermoData thermoItem;
+            if (extractThermoSpecies(record, i, thermoItem, m_verbose)) {
+                m_mechanism.thermoSpecies.push_back(std::move(thermoItem));
+            }
+        }
+        catch (const std::exception& e) {
+            if (m_verbose) {
+                std::cerr << "处理物种 #" << (i + 1) << " 时出错: " << e.what() << std::endl;
+                std::cerr << "继续处理下一个物种..." << std::endl;
+            }
+        }
+
+        try {
+            TransportData transportItem;
+            if (extractTransportSpecies(record, i, transportItem, m_verbose)) {
+                m_mechanism.transportSpecies.push_back(std::move(transportItem));
+            }
+        }
+        catch (const std::exception& e) {
+            if (m_verbose) {
+                std::cerr << "处理物种 #" << (i + 1) << " 输运性质时出错: " << e.what() << std::endl;
+                std::cerr << "继续处理下一个物种..." << std::endl;
+            }
+        }
+    }
+
+    MechanismData& m_mechanism;
+    bool m_verbose;
+
+    YamlNodeBuilder m_builder;
+    State m_state = State::Start;
+    State m_skipReturn = State::RootKey;
+    Section m_section = Section::None;
+    std::string m_key;
+    int m_skipDepth = 0;
+    size_t m_index = 0;
+};
+
+// 解析第一个YAML文档, 结果写入mechanism(出错时保留已提取的部分)
+void streamMechanism(std::istream& input, bool verbose, MechanismData& mechanism) {
+    try {
+        YAML::Parser parser(input);
+        MechanismEventHandler handler(mechanism, verbose);
+        parser.HandleNextDocument(handler);
+    }
+    catch (const YAML::Exception& e) {
+        throw std::runtime_error("YAML parsing error: " + std::string(e.what()));
+    }
+    indexSpecies(mechanism, verbose);
+}
+
+} // namespace
+
+MechanismData loadMechanismStreaming(const std::string& yamlFile, bool verbose) {
+    MechanismData mechanism;
+
+    try {
+        if (verbose) std::cout << "流式加载机理文件: " << yamlFile << std::endl;
+        std::ifstream input(yamlFile, std::ios::binary);
+        if (!input) {
+            throw std::runtime_error("无法打开文件: " + yamlFile);
+        }
+        streamMechanism(input, verbose, mechanism);
+    }
+    catch (const std::exception& e) {
+        std::cerr << "错误: " << e.what() << std::endl;
+    }
+
+    return mechanism;
+}
+
+MechanismData loadMechanismStreaming(std::istream& input, bool verbose) {
+    MechanismData mechanism;
+    streamMechanism(input, verbose, mechanism);
+    return mechanism;
+}
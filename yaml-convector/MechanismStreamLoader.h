@@ -0,0 +1,16 @@
+#pragma once
+#include <istream>
+#include <string>
+#include "Mechanism.h"
+
+// ========== 流式(事件驱动)机理加载 ==========
+// 直接消费 YAML::Parser 的解析事件, 逐条处理根节点下 reactions/species 序列中的记录:
+// 每次只构建当前一条记录的 YamlValue, 提取到 ReactionData/ThermoData/TransportData 后立即释放.
+// 整个文件的 YAML::Node 树和 YamlValue 树都不会生成, 峰值内存只与单条记录的大小相关.
+// 提取规则与 loadMechanism 相同(复用 extractReaction/extractThermoSpecies/extractTransportSpecies).
+
+// 从文件流式加载机理数据, 出错时打印错误信息并返回已解析的部分
+MechanismData loadMechanismStreaming(const std::string& yamlFile, bool verbose = false);
+
+// 从输入流流式加载机理数据, YAML语法错误时抛出 std::runtime_error
+MechanismData loadMechanismStreaming(std::istream& input, bool verbose = false);
@@ -0,0 +1,138 @@
+#include "MixtureTransport.h"
+#include "SimdMath.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+using simd::Vec;
+
+constexpr double kTinyMoleFraction = 1e-20;
+
+// 读取一组状态; 不足 kWidth 个时用最后一个状态补齐, 避免空通道出现0温度
+Vec loadStates(const double* p, size_t n) {
+    if (n == simd::kWidth) return Vec::load(p);
+    double padded[simd::kWidth];
+    for (size_t i = 0; i < simd::kWidth; i++) padded[i] = p[i < n ? i : n - 1];
+    return Vec::load(padded);
+}
+
+void storeStates(Vec value, double* p, size_t n) {
+    if (n == simd::kWidth) value.store(p);
+    else value.storePartial(p, n);
+}
+
+// 按 lnT 升幂的多项式, 系数为标量
+Vec horner(const double* coeffs, size_t stride, Vec x) {
+    Vec p = coeffs[TransportFits::kDegree * stride];
+    for (size_t c = TransportFits::kDegree; c-- > 0;) p = fmadd(p, x, Vec(coeffs[c * stride]));
+    return p;
+}
+
+} // namespace
+
+MixtureTransport::MixtureTransport(const TransportFits& fits) : m_fits(fits) {
+    const size_t count = fits.size();
+    const auto& W = fits.molecularWeights();
+    m_wilkeA.resize(count * count);
+    m_wilkeB.resize(count * count);
+    for (size_t k = 0; k < count; k++) {
+        for (size_t j = 0; j < count; j++) {
+            m_wilkeA[k * count + j] = std::sqrt(std::sqrt(W[j] / W[k]));
+            m_wilkeB[k * count + j] = 1.0 / std::sqrt(8.0 * (1.0 + W[k] / W[j]));
+        }
+    }
+}
+
+void MixtureTransport::evaluate(const double* T, const double* P, const double* X, size_t stateCount,
+    double* viscosity, double* conductivity, double* diffusion) const {
+    constexpr size_t W = simd::kWidth;
+    const size_t count = size();
+    if (count == 0) return;
+
+    const auto& weights = m_fits.molecularWeights();
+    const double* viscosityCoeffs = m_fits.viscosityCoeffs().data();
+    const double* conductivityCoeffs = m_fits.conductivityCoeffs().data();
+    const double* diffusionCoeffs = m_fits.diffusionCoeffs().data();
+    const size_t stride = m_fits.stride();
+    const size_t pairStride = m_fits.pairStride();
+
+    // 每个物种一个向量(kWidth 个状态)
+    std::vector<double> x(count * W);
+    std::vector<double> sqrtEta(count * W);
+    std::vector<double> invSqrtEta(count * W);
+    std::vector<double> sums(count * W);
+
+    for (size_t s = 0; s < stateCount; s += W) {
+        const size_t n = stateCount - s < W ? stateCount - s : W;
+        const Vec vT = loadStates(T + s, n);
+        const Vec vP = loadStates(P + s, n);
+        const Vec logT = log(vT);
+        const Vec quarterT = exp(logT * Vec(0.25));   // T^(1/4)
+        const Vec sqrtT = quarterT * quarterT;
+
+        Vec meanWeight = 0.0;
+        for (size_t k = 0; k < count; k++) {
+            Vec xk = max(loadStates(X + k * stateCount + s, n), Vec(kTinyMoleFraction));
+            xk.store(x.data() + k * W);
+            meanWeight = fmadd(xk, Vec(weights[k]), meanWeight);
+        }
+
+        if (viscosity) {
+            // η_k = sqrt(T) p_k^2, sqrt(η_k) = T^(1/4) p_k
+            for (size_t k = 0; k < count; k++) {
+                Vec root = horner(viscosityCoeffs + k, stride, logT) * quarterT;
+                root.store(sqrtEta.data() + k * W);
+                (Vec(1.0) / root).store(invSqrtEta.data() + k * W);
+            }
+            Vec mixture = 0.0;
+            for (size_t k = 0; k < count; k++) {
+                const Vec rootK = Vec::load(sqrtEta.data() + k * W);
+                const double* a = m_wilkeA.data() + k * count;
+                const double* b = m_wilkeB.data() + k * count;
+                Vec denominator = 0.0;
+                for (size_t j = 0; j < count; j++) {
+                    Vec f = fmadd(rootK * Vec(a[j]), Vec::load(invSqrtEta.data() + j * W), Vec(1.0));
+                    denominator = fmadd(f * f * Vec(b[j]), Vec::load(x.data() + j * W), denominator);
+                }
+                mixture = fmadd(Vec::load(x.data() + k * W) * rootK * rootK, Vec(1.0) / denominator, mixture);
+            }
+            storeStates(mixture, viscosity + s, n);
+        }
+
+        if (conductivity) {
+            Vec sum = 0.0;
+            Vec inverseSum = 0.0;
+            for (size_t k = 0; k < count; k++) {
+                const Vec xk = Vec::load(x.data() + k * W);
+                const Vec lambda = horner(conductivityCoeffs + k, stride, logT) * sqrtT;
+                sum = fmadd(xk, lambda, sum);
+                inverseSum = inverseSum + xk / lambda;
+            }
+            storeStates(Vec(0.5) * (sum + Vec(1.0) / inverseSum), conductivity + s, n);
+        }
+
+        if (diffusion) {
+            // 1/D_kj = P / (T^1.5 p_kj), 对称, 每对只计算一次
+            const Vec scale = vP / (sqrtT * vT);
+            if (count == 1) {
+                storeStates(horner(diffusionCoeffs, pairStride, logT) / scale, diffusion + s, n);
+                continue;
+            }
+            std::fill(sums.begin(), sums.end(), 0.0);
+            for (size_t k = 0; k < count; k++) {
+                const Vec xk = Vec::load(x.data() + k * W);
+                Vec sumK = Vec::load(sums.data() + k * W);
+                // 第 k 行的物种对 (k, j > k) 在压缩上三角中连续
+                const double* row = diffusionCoeffs + m_fits.pairIndex(k, k);
+                for (size_t j = k + 1; j < count; j++) {
+                    const Vec inverse = scale / horner(row + (j - k), pairStride, logT);
+                    sumK = fmadd(Vec::load(x.data() + j * W), inverse, sumK);
+                    fmadd(xk, inverse, Vec::load(sums.data() + j * W)).store(sums.data() + j * W);
+                }
+                const Vec value = (meanWeight - xk * Vec(weights[k])) / (meanWeight * sumK);
+                storeStates(value, diffusion + k * stateCount + s, n);
+            }
+        }
+    }
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+#include "TransportFits.h"
+
+// ========== 混合物平均输运性质(批量) ==========
+// 由 TransportFits 的纯物种拟合计算混合物性质(与 Cantera 的 MixTransport 相同):
+//   粘度 Wilke 公式:  η = Σ_k x_k η_k / Σ_j x_j Φ_kj,
+//                     Φ_kj = [1 + sqrt(η_k/η_j) (W_j/W_k)^(1/4)]^2 / sqrt(8 (1 + W_k/W_j))
+//   导热系数:         λ = (Σ_k x_k λ_k + 1 / Σ_k (x_k/λ_k)) / 2
+//   混合物平均扩散:   D_km = (W̄ - x_k W_k) / (W̄ Σ_{j≠k} x_j/D_kj)
+// 摩尔分数小于 1e-20 时按 1e-20 计算, 使纯物种和缺失物种的 D_km 有限.
+// 状态按 (T, P, X) 数组结构传入, 每 kWidth 个状态为一组放在向量的各通道中, O(K^2) 的 Wilke 求和和
+// 二元扩散求和对整组向量化; Φ_kj 中只与分子量有关的因子在构造时预先计算.
+class MixtureTransport {
+public:
+    MixtureTransport() = default;
+    explicit MixtureTransport(const TransportFits& fits);
+
+    // 物种数, 物种顺序与 TransportFits 相同
+    size_t size() const { return m_fits.size(); }
+    const TransportFits& fits() const { return m_fits; }
+
+    // 一批状态: T[s] [K], P[s] [Pa], X[k * stateCount + s];
+    // 输出 viscosity[s] [Pa·s], conductivity[s] [W/(m·K)], diffusion[k * stateCount + s] [m^2/s], 不需要的量传 nullptr
+    void evaluate(const double* T, const double* P, const double* X, size_t stateCount,
+        double* viscosity, double* conductivity, double* diffusion) const;
+
+private:
+    TransportFits m_fits;
+    std::vector<double> m_wilkeA;   // [k * K + j] (W_j/W_k)^(1/4)
+    std::vector<double> m_wilkeB;   // [k * K + j] 1 / sqrt(8 (1 + W_k/W_j))
+};
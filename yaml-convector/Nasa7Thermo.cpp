@@ -0,0 +1,75 @@
+#include "Nasa7Thermo.h"
+#include "SimdMath.h"
+#include <cmath>
+
+Nasa7Thermo::Nasa7Thermo(const std::vector<ThermoData>& thermoSpecies) {
+    for (size_t i = 0; i < thermoSpecies.size(); i++) {
+        if (thermoSpecies[i].coefficients.low.size() == 7) {
+            m_species.push_back(static_cast<uint32_t>(i));
+        }
+    }
+
+    const size_t count = m_species.size();
+    m_stride = (count + simd::kWidth - 1) / simd::kWidth * simd::kWidth;
+    m_coeffs.assign(2 * 7 * m_stride, 0.0);
+    m_Tmid.assign(m_stride, 0.0);
+
+    for (size_t k = 0; k < count; k++) {
+        const ThermoData& thermo = thermoSpecies[m_species[k]];
+        const auto& low = thermo.coefficients.low;
+        // 只有一个温区时高温系数与低温相同
+        const auto& high = thermo.coefficients.high.size() == 7 ? thermo.coefficients.high : low;
+        for (size_t c = 0; c < 7; c++) {
+            m_coeffs[c * m_stride + k] = low[c];
+            m_coeffs[(7 + c) * m_stride + k] = high[c];
+        }
+
+        const auto& ranges = thermo.temperatureRanges;
+        m_Tmid[k] = ranges.size() >= 3 ? ranges[1] : (ranges.empty() ? 0.0 : ranges.back());
+    }
+}
+
+void Nasa7Thermo::evaluate(double T, double* cpR, double* hRT, double* sR, double* gRT) const {
+    using simd::Vec;
+    const Vec vT = T;
+    const Vec T2 = T * T;
+    const Vec T3 = T * T * T;
+    const Vec T4 = T * T * T * T;
+    const Vec invT = 1.0 / T;
+    const Vec logT = std::log(T);
+    const size_t count = size();
+
+    for (size_t k = 0; k < count; k += simd::kWidth) {
+        // T > Tmid 时取高温系数
+        const Vec high = max(vT - Vec::load(m_Tmid.data() + k), 0.0);
+        Vec a[7];
+        for (size_t c = 0; c < 7; c++) {
+            a[c] = select(high, Vec::load(coeffRow(1, c) + k), Vec::load(coeffRow(0, c) + k));
+        }
+
+        const size_t n = count - k < simd::kWidth ? count - k : simd::kWidth;
+        auto store = [k, n](Vec value, double* out) {
+            if (!out) return;
+            if (n == simd::kWidth) value.store(out + k);
+            else value.storePartial(out + k, n);
+        };
+
+        Vec h = a[0] + a[1] * vT * Vec(1.0 / 2) + a[2] * T2 * Vec(1.0 / 3) + a[3] * T3 * Vec(1.0 / 4)
+            + a[4] * T4 * Vec(1.0 / 5) + a[5] * invT;
+        Vec s = a[0] * logT + a[1] * vT + a[2] * T2 * Vec(1.0 / 2) + a[3] * T3 * Vec(1.0 / 3)
+            + a[4] * T4 * Vec(1.0 / 4) + a[6];
+        if (cpR) store(a[0] + a[1] * vT + a[2] * T2 + a[3] * T3 + a[4] * T4, cpR);
+        store(h, hRT);
+        store(s, sR);
+        store(h - s, gRT);
+    }
+}
+
+void Nasa7Thermo::evaluate(const double* T, size_t temperatureCount,
+    double* cpR, double* hRT, double* sR, double* gRT) const {
+    const size_t count = size();
+    auto offset = [count](double* out, size_t t) { return out ? out + t * count : nullptr; };
+    for (size_t t = 0; t < temperatureCount; t++) {
+        evaluate(T[t], offset(cpR, t), offset(hRT, t), offset(sR, t), offset(gRT, t));
+    }
+}
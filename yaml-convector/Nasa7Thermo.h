@@ -0,0 +1,37 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Mechanism.h"
+
+// ========== NASA7 热力学性质 ==========
+// cp/R = a0 + a1 T + a2 T^2 + a3 T^3 + a4 T^4
+// h/RT = a0 + a1 T/2 + a2 T^2/3 + a3 T^3/4 + a4 T^4/5 + a5/T
+// s/R  = a0 lnT + a1 T + a2 T^2/2 + a3 T^3/3 + a4 T^4/4 + a6
+// g/RT = h/RT - s/R
+// 系数按 (温区, 系数序号) 分行、物种为列存放, 每行补齐到向量宽度的整数倍; 每个物种按 T > Tmid
+// 在低温/高温系数间逐元素选择, 不分支. 调用时不分配内存.
+class Nasa7Thermo {
+public:
+    Nasa7Thermo() = default;
+    // 只收录有 NASA7 系数(coefficients.low 为7个)的物种, 其余物种(如 NASA9)跳过
+    explicit Nasa7Thermo(const std::vector<ThermoData>& thermoSpecies);
+
+    size_t size() const { return m_species.size(); }
+    // 第 k 个物种在 thermoSpecies 中的下标(即 MechanismData::species 中的下标)
+    const std::vector<uint32_t>& species() const { return m_species; }
+
+    // 单个温度, 输出长度为 size(); 不需要的量传 nullptr
+    void evaluate(double T, double* cpR, double* hRT, double* sR, double* gRT) const;
+    // 一批温度: 输出 [t * size() + k]
+    void evaluate(const double* T, size_t temperatureCount,
+        double* cpR, double* hRT, double* sR, double* gRT) const;
+
+private:
+    const double* coeffRow(size_t range, size_t c) const { return m_coeffs.data() + (range * 7 + c) * m_stride; }
+
+    std::vector<uint32_t> m_species;
+    size_t m_stride = 0;            // 每行长度(补齐后的物种数)
+    std::vector<double> m_coeffs;   // [温区(0低温, 1高温)][系数 0-6][物种]
+    std::vector<double> m_Tmid;     // [物种]
+};
@@ -0,0 +1,96 @@
+#include "Nasa9Thermo.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+Nasa9Thermo::Nasa9Thermo(const std::vector<ThermoData>& thermoSpecies) {
+    // 每个物种的温区上限, 与 m_coeffs 中的温区一一对应
+    std::vector<uint32_t> firstRange;
+    std::vector<double> upperBounds;
+
+    for (size_t i = 0; i < thermoSpecies.size(); i++) {
+        const ThermoData& thermo = thermoSpecies[i];
+        if (thermo.nasa9Coeffs.empty()) continue;
+
+        std::vector<const ThermoData::NASA9Range*> ranges;
+        for (const auto& range : thermo.nasa9Coeffs) {
+            if (range.temperatureRange.size() != 2 || range.coefficients.size() != 9) {
+                throw std::runtime_error("物种 " + thermo.name + ": NASA9 温区需要2个温度和9个系数");
+            }
+            ranges.push_back(&range);
+        }
+        std::sort(ranges.begin(), ranges.end(), [](const auto* a, const auto* b) {
+            return a->temperatureRange[0] < b->temperatureRange[0];
+        });
+
+        m_species.push_back(static_cast<uint32_t>(i));
+        firstRange.push_back(static_cast<uint32_t>(upperBounds.size()));
+        for (const auto* range : ranges) {
+            m_coeffs.insert(m_coeffs.end(), range->coefficients.begin(), range->coefficients.end());
+            upperBounds.push_back(range->temperatureRange[1]);
+            m_breakpoints.push_back(range->temperatureRange[0]);
+            m_breakpoints.push_back(range->temperatureRange[1]);
+        }
+    }
+    firstRange.push_back(static_cast<uint32_t>(upperBounds.size()));
+
+    std::sort(m_breakpoints.begin(), m_breakpoints.end());
+    m_breakpoints.erase(std::unique(m_breakpoints.begin(), m_breakpoints.end()), m_breakpoints.end());
+
+    // 全局区间 j 为 (breakpoints[j-1], breakpoints[j]], 首尾两个区间向外延伸;
+    // 取区间内一点, 物种使用上限不小于该点的第一个温区, 都小于时用最后一个
+    const size_t count = m_species.size();
+    const size_t intervals = m_breakpoints.size() + 1;
+    m_rangeIndex.resize(intervals * count);
+    for (size_t j = 0; j < intervals; j++) {
+        double x;
+        if (m_breakpoints.empty()) x = 0.0;
+        else if (j == 0) x = m_breakpoints.front();
+        else if (j == m_breakpoints.size()) x = m_breakpoints.back() + 1.0;
+        else x = 0.5 * (m_breakpoints[j - 1] + m_breakpoints[j]);
+
+        for (size_t k = 0; k < count; k++) {
+            uint32_t r = firstRange[k];
+            while (r + 1 < firstRange[k + 1] && upperBounds[r] < x) r++;
+            m_rangeIndex[j * count + k] = r;
+        }
+    }
+}
+
+void Nasa9Thermo::evaluate(double T, double* cpR, double* hRT, double* sR, double* gRT) const {
+    const size_t count = size();
+    if (count == 0) return;
+
+    const size_t interval = std::lower_bound(m_breakpoints.begin(), m_breakpoints.end(), T) - m_breakpoints.begin();
+    const uint32_t* rangeIndex = m_rangeIndex.data() + interval * count;
+
+    // 所有物种共用的 T 的幂次
+    const double T2 = T * T;
+    const double T3 = T2 * T;
+    const double T4 = T3 * T;
+    const double invT = 1.0 / T;
+    const double invT2 = invT * invT;
+    const double logT = std::log(T);
+
+    for (size_t k = 0; k < count; k++) {
+        const double* a = m_coeffs.data() + rangeIndex[k] * 9;
+        const double poly = a[3] * T + a[4] * T2 + a[5] * T3 + a[6] * T4;
+        const double h = -a[0] * invT2 + a[1] * logT * invT + a[2] + a[3] * T / 2 + a[4] * T2 / 3
+            + a[5] * T3 / 4 + a[6] * T4 / 5 + a[7] * invT;
+        const double s = -a[0] * invT2 / 2 - a[1] * invT + a[2] * logT + a[3] * T + a[4] * T2 / 2
+            + a[5] * T3 / 3 + a[6] * T4 / 4 + a[8];
+        if (cpR) cpR[k] = a[0] * invT2 + a[1] * invT + a[2] + poly;
+        if (hRT) hRT[k] = h;
+        if (sR) sR[k] = s;
+        if (gRT) gRT[k] = h - s;
+    }
+}
+
+void Nasa9Thermo::evaluate(const double* T, size_t temperatureCount,
+    double* cpR, double* hRT, double* sR, double* gRT) const {
+    const size_t count = size();
+    auto offset = [count](double* out, size_t t) { return out ? out + t * count : nullptr; };
+    for (size_t t = 0; t < temperatureCount; t++) {
+        evaluate(T[t], offset(cpR, t), offset(hRT, t), offset(sR, t), offset(gRT, t));
+    }
+}
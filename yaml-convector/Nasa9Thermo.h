@@ -0,0 +1,37 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Mechanism.h"
+
+// ========== NASA9 多温区热力学性质 ==========
+// 每个温区9个系数 a1-a7, b1, b2:
+// cp/R = a1 T^-2 + a2 T^-1 + a3 + a4 T + a5 T^2 + a6 T^3 + a7 T^4
+// h/RT = -a1 T^-2 + a2 lnT/T + a3 + a4 T/2 + a5 T^2/3 + a6 T^3/4 + a7 T^4/5 + b1/T
+// s/R  = -a1 T^-2/2 - a2 T^-1 + a3 lnT + a4 T + a5 T^2/2 + a6 T^3/3 + a7 T^4/4 + b2
+// 全部物种的全部温区系数连续存放. 所有温区端点合并排序为全局断点, 预先为每个全局区间记下
+// 各物种使用的温区; 计算时对断点二分一次, 之后每个物种直接取温区, 不逐个扫描.
+// 与 Cantera 一致: T 等于端点时取低温一侧的温区, 超出范围时使用最近的温区外推.
+class Nasa9Thermo {
+public:
+    Nasa9Thermo() = default;
+    // 只收录有 nasa9Coeffs 的物种; 温区格式错误(温度不是2个或系数不是9个)时抛出 std::runtime_error
+    explicit Nasa9Thermo(const std::vector<ThermoData>& thermoSpecies);
+
+    size_t size() const { return m_species.size(); }
+    // 第 k 个物种在 thermoSpecies 中的下标(即 MechanismData::species 中的下标)
+    const std::vector<uint32_t>& species() const { return m_species; }
+    size_t rangeCount() const { return m_coeffs.size() / 9; }
+
+    // 单个温度, 输出长度为 size(); 不需要的量传 nullptr
+    void evaluate(double T, double* cpR, double* hRT, double* sR, double* gRT) const;
+    // 一批温度: 输出 [t * size() + k]
+    void evaluate(const double* T, size_t temperatureCount,
+        double* cpR, double* hRT, double* sR, double* gRT) const;
+
+private:
+    std::vector<uint32_t> m_species;
+    std::vector<double> m_coeffs;           // [温区][9], 同一物种的温区按温度升序相邻
+    std::vector<double> m_breakpoints;      // 全局断点, 升序且不重复
+    std::vector<uint32_t> m_rangeIndex;     // [全局区间][物种] -> 温区在 m_coeffs 中的序号
+};
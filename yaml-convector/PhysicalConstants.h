@@ -0,0 +1,29 @@
+#pragma once
+
+// ========== 物理常数(SI, 物质的量以 kmol 计, 与 Cantera 一致) ==========
+
+constexpr double Pi = 3.14159265358979323846;
+
+// 阿伏伽德罗常数 [1/kmol]
+constexpr double Avogadro = 6.02214076e26;
+
+// 玻尔兹曼常数 [J/K]
+constexpr double Boltzmann = 1.380649e-23;
+
+// 通用气体常数 [J/kmol/K]
+constexpr double GasConstant = Avogadro * Boltzmann;
+
+// 标准大气压 [Pa]
+constexpr double OneAtm = 101325.0;
+
+// 元电荷 [C]
+constexpr double ElectronCharge = 1.602176634e-19;
+
+// 热化学卡 [J]
+constexpr double Calorie = 4.184;
+
+// 真空中的光速 [m/s]
+constexpr double LightSpeed = 299792458.0;
+
+// 真空介电常数 [F/m]
+constexpr double Epsilon0 = 8.8541878128e-12;
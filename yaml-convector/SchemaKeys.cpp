@@ -0,0 +1,83 @@
+#include "SchemaKeys.h"
+#include <unordered_map>
+
+namespace {
+
+// 与 SchemaKey 枚举顺序一致
+constexpr std::string_view kKeyNames[] = {
+    "",
+    "reactions",
+    "species",
+    "units",
+    "equation",
+    "type",
+    "rate-constant",
+    "A",
+    "A-units",
+    "b",
+    "Ea",
+    "Ea-units",
+    "efficiencies",
+    "low-P-rate-constant",
+    "high-P-rate-constant",
+    "Troe",
+    "a",
+    "T*",
+    "T**",
+    "T***",
+    "SRI",
+    "Tsang",
+    "duplicate",
+    "orders",
+    "name",
+    "composition",
+    "thermo",
+    "model",
+    "temperature-ranges",
+    "coefficients",
+    "low",
+    "high",
+    "nasa9-coeffs",
+    "T-range",
+    "coeffs",
+    "transport",
+    "geometry",
+    "diameter",
+    "well-depth",
+    "dipole",
+    "polarizability",
+    "rotational-relaxation",
+    "note",
+    "length",
+    "time",
+    "quantity",
+    "activation-energy",
+};
+
+static_assert(sizeof(kKeyNames) / sizeof(kKeyNames[0]) == static_cast<size_t>(SchemaKey::Count),
+    "kKeyNames must match SchemaKey");
+
+// 只在首次调用时构建, 之后只读(多线程安全)
+const std::unordered_map<std::string_view, SchemaKey>& keyTable() {
+    static const std::unordered_map<std::string_view, SchemaKey> table = []() {
+        std::unordered_map<std::string_view, SchemaKey> result;
+        for (size_t i = 1; i < static_cast<size_t>(SchemaKey::Count); i++) {
+            result.emplace(kKeyNames[i], static_cast<SchemaKey>(i));
+        }
+        return result;
+    }();
+    return table;
+}
+
+} // namespace
+
+SchemaKey internKey(std::string_view key) {
+    const auto& table = keyTable();
+    auto it = table.find(key);
+    return it != table.end() ? it->second : SchemaKey::Unknown;
+}
+
+std::string_view keyName(SchemaKey key) {
+    size_t index = static_cast<size_t>(key);
+    return index < static_cast<size_t>(SchemaKey::Count) ? kKeyNames[index] : kKeyNames[0];
+}
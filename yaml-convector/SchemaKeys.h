@@ -0,0 +1,73 @@
+#pragma once
+#include <cstdint>
+#include <string_view>
+
+// ========== Cantera YAML 模式键 ==========
+// 提取函数使用到的映射表键在解析时被转换为小整数ID, 字段查找只需比较整数,
+// 不再在每条反应/每个物种上做字符串比较. 其他键的ID为 Unknown.
+
+enum class SchemaKey : uint16_t {
+    Unknown = 0,
+
+    // 根节点
+    Reactions,
+    Species,
+    Units,
+
+    // 反应
+    Equation,
+    Type,
+    RateConstant,          // rate-constant
+    A,
+    AUnits,                // A-units
+    B,                     // b
+    Ea,
+    EaUnits,               // Ea-units
+    Efficiencies,
+    LowPRateConstant,      // low-P-rate-constant
+    HighPRateConstant,     // high-P-rate-constant
+    Troe,
+    TroeA,                 // a
+    TStar,                 // T*
+    TDoubleStar,           // T**
+    TTripleStar,           // T***
+    Sri,                   // SRI
+    Tsang,
+    Duplicate,
+    Orders,
+
+    // 物种
+    Name,
+    Composition,
+    Thermo,
+    Model,
+    TemperatureRanges,     // temperature-ranges
+    Coefficients,
+    Low,
+    High,
+    Nasa9Coeffs,           // nasa9-coeffs
+    TRange,                // T-range
+    Coeffs,
+    Transport,
+    Geometry,
+    Diameter,
+    WellDepth,             // well-depth
+    Dipole,
+    Polarizability,
+    RotationalRelaxation,  // rotational-relaxation
+    Note,
+
+    // 单位(units)
+    Length,
+    Time,
+    Quantity,
+    ActivationEnergy,      // activation-energy
+
+    Count
+};
+
+// 将键文本转换为ID(解析时调用), 不是模式键时返回 SchemaKey::Unknown
+SchemaKey internKey(std::string_view key);
+
+// ID对应的键文本
+std::string_view keyName(SchemaKey key);
@@ -0,0 +1,279 @@
+#pragma once
+#include <cmath>
+#include <cstddef>
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// ========== SIMD 数学函数 ==========
+// 按编译选项选择实现: AVX-512(-mavx512f, /arch:AVX512) > AVX2(-mavx2 -mfma, /arch:AVX2) > 标量.
+// 向量 exp 使用 Cody-Waite 约化 + 13阶多项式, 在全部有效范围内相对误差约 2e-16;
+// 上溢返回 inf, 下溢返回0(含次正规数), NaN 原样传递.
+// 向量 log 把 x 分解为 m*2^e (m 在 [sqrt(1/2), sqrt(2)) 内), 对 ln m 用 atanh 级数, 相对误差约 4e-16;
+// x=0 返回 -inf, x<0 返回 NaN; AVX2 路径不处理次正规数输入.
+// Vec 对上述内建类型做薄封装, 使同一份计算代码适用于各指令集.
+
+#if defined(__AVX512F__)
+#define YC_SIMD_AVX512 1
+#elif defined(__AVX2__)
+#define YC_SIMD_AVX2 1
+#endif
+
+namespace simd {
+
+#if defined(YC_SIMD_AVX512)
+constexpr size_t kWidth = 8;
+constexpr const char* kIsaName = "AVX-512";
+#elif defined(YC_SIMD_AVX2)
+constexpr size_t kWidth = 4;
+constexpr const char* kIsaName = "AVX2";
+#else
+constexpr size_t kWidth = 1;
+constexpr const char* kIsaName = "scalar";
+#endif
+
+namespace detail {
+
+constexpr double kLog2e = 1.4426950408889634074;
+constexpr double kLn2Hi = 6.93145751953125e-1;
+constexpr double kLn2Lo = 1.42860682030941723212e-6;
+constexpr double kExpMax = 709.782712893384;
+constexpr double kExpMin = -745.1332191019412;
+constexpr double kSqrt2 = 1.41421356237309504880;
+
+// ln m = 2*atanh(s), s = (m-1)/(m+1), |s| <= 0.1716: 系数 2/(2k+1), 从高阶到低阶
+constexpr double kLogCoeffs[] = {
+    2.0 / 23.0, 2.0 / 21.0, 2.0 / 19.0, 2.0 / 17.0, 2.0 / 15.0, 2.0 / 13.0,
+    2.0 / 11.0, 2.0 / 9.0, 2.0 / 7.0, 2.0 / 5.0, 2.0 / 3.0, 2.0
+};
+
+// exp(r) 在 |r| <= ln2/2 上的泰勒系数 1/k!, 从高阶到低阶
+constexpr double kExpCoeffs[] = {
+    1.0 / 6227020800.0, 1.0 / 479001600.0, 1.0 / 39916800.0, 1.0 / 3628800.0,
+    1.0 / 362880.0, 1.0 / 40320.0, 1.0 / 5040.0, 1.0 / 720.0, 1.0 / 120.0,
+    1.0 / 24.0, 1.0 / 6.0, 0.5, 1.0, 1.0
+};
+
+} // namespace detail
+
+#if defined(YC_SIMD_AVX512)
+
+inline __m512d exp(__m512d x) {
+    using namespace detail;
+    __m512d xc = _mm512_min_pd(_mm512_max_pd(x, _mm512_set1_pd(kExpMin)), _mm512_set1_pd(kExpMax));
+    __m512d n = _mm512_roundscale_pd(_mm512_mul_pd(xc, _mm512_set1_pd(kLog2e)),
+        _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m512d r = _mm512_fnmadd_pd(n, _mm512_set1_pd(kLn2Hi), xc);
+    r = _mm512_fnmadd_pd(n, _mm512_set1_pd(kLn2Lo), r);
+
+    __m512d p = _mm512_set1_pd(kExpCoeffs[0]);
+    for (size_t k = 1; k < sizeof(kExpCoeffs) / sizeof(double); k++) {
+        p = _mm512_fmadd_pd(p, r, _mm512_set1_pd(kExpCoeffs[k]));
+    }
+
+    // scalef 直接处理指数上溢和下溢
+    __m512d result = _mm512_scalef_pd(p, n);
+    result = _mm512_mask_mov_pd(result, _mm512_cmp_pd_mask(x, _mm512_set1_pd(kExpMax), _CMP_GT_OQ),
+        _mm512_set1_pd(HUGE_VAL));
+    result = _mm512_mask_mov_pd(result, _mm512_cmp_pd_mask(x, _mm512_set1_pd(kExpMin), _CMP_LT_OQ),
+        _mm512_setzero_pd());
+    return _mm512_mask_mov_pd(result, _mm512_cmp_pd_mask(x, x, _CMP_UNORD_Q), x);
+}
+
+#elif defined(YC_SIMD_AVX2)
+
+inline __m256d fmadd(__m256d a, __m256d b, __m256d c) {
+#if defined(__FMA__) || defined(_MSC_VER)
+    return _mm256_fmadd_pd(a, b, c);
+#else
+    return _mm256_add_pd(_mm256_mul_pd(a, b), c);
+#endif
+}
+
+inline __m256d fnmadd(__m256d a, __m256d b, __m256d c) {
+#if defined(__FMA__) || defined(_MSC_VER)
+    return _mm256_fnmadd_pd(a, b, c);
+#else
+    return _mm256_sub_pd(c, _mm256_mul_pd(a, b));
+#endif
+}
+
+inline __m256d exp(__m256d x) {
+    using namespace detail;
+    __m256d xc = _mm256_min_pd(_mm256_max_pd(x, _mm256_set1_pd(kExpMin)), _mm256_set1_pd(kExpMax));
+    __m256d n = _mm256_round_pd(_mm256_mul_pd(xc, _mm256_set1_pd(kLog2e)),
+        _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    __m256d r = fnmadd(n, _mm256_set1_pd(kLn2Hi), xc);
+    r = fnmadd(n, _mm256_set1_pd(kLn2Lo), r);
+
+    __m256d p = _mm256_set1_pd(kExpCoeffs[0]);
+    for (size_t k = 1; k < sizeof(kExpCoeffs) / sizeof(double); k++) {
+        p = fmadd(p, r, _mm256_set1_pd(kExpCoeffs[k]));
+    }
+
+    // 2^n 分两次相乘, n 的范围 [-1075, 1024] 超出单个双精度指数的表示范围
+    __m128i n32 = _mm256_cvtpd_epi32(n);
+    __m128i half = _mm_srai_epi32(n32, 1);
+    __m128i rest = _mm_sub_epi32(n32, half);
+    const __m256i bias = _mm256_set1_epi64x(1023);
+    __m256d scale1 = _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_add_epi64(_mm256_cvtepi32_epi64(half), bias), 52));
+    __m256d scale2 = _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_add_epi64(_mm256_cvtepi32_epi64(rest), bias), 52));
+    __m256d result = _mm256_mul_pd(_mm256_mul_pd(p, scale1), scale2);
+
+    result = _mm256_blendv_pd(result, _mm256_set1_pd(HUGE_VAL), _mm256_cmp_pd(x, _mm256_set1_pd(kExpMax), _CMP_GT_OQ));
+    result = _mm256_blendv_pd(result, _mm256_setzero_pd(), _mm256_cmp_pd(x, _mm256_set1_pd(kExpMin), _CMP_LT_OQ));
+    return _mm256_blendv_pd(result, x, _mm256_cmp_pd(x, x, _CMP_UNORD_Q));
+}
+
+#endif
+
+#if defined(YC_SIMD_AVX512)
+
+inline __m512d log(__m512d x) {
+    using namespace detail;
+    __m512d e = _mm512_getexp_pd(x);
+    __m512d m = _mm512_getmant_pd(x, _MM_MANT_NORM_1_2, _MM_MANT_SIGN_nan);
+    __mmask8 big = _mm512_cmp_pd_mask(m, _mm512_set1_pd(kSqrt2), _CMP_GT_OQ);
+    m = _mm512_mask_mul_pd(m, big, m, _mm512_set1_pd(0.5));
+    e = _mm512_mask_add_pd(e, big, e, _mm512_set1_pd(1.0));
+
+    __m512d s = _mm512_div_pd(_mm512_sub_pd(m, _mm512_set1_pd(1.0)), _mm512_add_pd(m, _mm512_set1_pd(1.0)));
+    __m512d s2 = _mm512_mul_pd(s, s);
+    __m512d p = _mm512_set1_pd(kLogCoeffs[0]);
+    for (size_t k = 1; k < sizeof(kLogCoeffs) / sizeof(double); k++) {
+        p = _mm512_fmadd_pd(p, s2, _mm512_set1_pd(kLogCoeffs[k]));
+    }
+    __m512d result = _mm512_fmadd_pd(e, _mm512_set1_pd(kLn2Lo), _mm512_mul_pd(p, s));
+    result = _mm512_fmadd_pd(e, _mm512_set1_pd(kLn2Hi), result);
+
+    // getexp/getmant 已处理 0、负数和 NaN 以外的特殊值, 这里补齐
+    result = _mm512_mask_mov_pd(result, _mm512_cmp_pd_mask(x, _mm512_setzero_pd(), _CMP_EQ_OQ),
+        _mm512_set1_pd(-HUGE_VAL));
+    result = _mm512_mask_mov_pd(result, _mm512_cmp_pd_mask(x, _mm512_set1_pd(HUGE_VAL), _CMP_EQ_OQ), x);
+    return _mm512_mask_mov_pd(result, _mm512_cmp_pd_mask(x, _mm512_setzero_pd(), _CMP_NGE_UQ),
+        _mm512_set1_pd(NAN));
+}
+
+#elif defined(YC_SIMD_AVX2)
+
+inline __m256d log(__m256d x) {
+    using namespace detail;
+    const __m256i bits = _mm256_castpd_si256(x);
+    // 带偏移的指数转换为 double: 与 2^52 的位模式相加后减去 2^52
+    const __m256i magic = _mm256_set1_epi64x(0x4330000000000000LL);
+    __m256d e = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(_mm256_srli_epi64(bits, 52), magic)),
+        _mm256_set1_pd(4503599627370496.0 + 1023.0));
+    __m256d m = _mm256_castsi256_pd(_mm256_or_si256(
+        _mm256_and_si256(bits, _mm256_set1_epi64x(0x000FFFFFFFFFFFFFLL)),
+        _mm256_set1_epi64x(0x3FF0000000000000LL)));
+    __m256d big = _mm256_cmp_pd(m, _mm256_set1_pd(kSqrt2), _CMP_GT_OQ);
+    m = _mm256_blendv_pd(m, _mm256_mul_pd(m, _mm256_set1_pd(0.5)), big);
+    e = _mm256_add_pd(e, _mm256_and_pd(big, _mm256_set1_pd(1.0)));
+
+    __m256d s = _mm256_div_pd(_mm256_sub_pd(m, _mm256_set1_pd(1.0)), _mm256_add_pd(m, _mm256_set1_pd(1.0)));
+    __m256d s2 = _mm256_mul_pd(s, s);
+    __m256d p = _mm256_set1_pd(kLogCoeffs[0]);
+    for (size_t k = 1; k < sizeof(kLogCoeffs) / sizeof(double); k++) {
+        p = fmadd(p, s2, _mm256_set1_pd(kLogCoeffs[k]));
+    }
+    __m256d result = fmadd(e, _mm256_set1_pd(kLn2Lo), _mm256_mul_pd(p, s));
+    result = fmadd(e, _mm256_set1_pd(kLn2Hi), result);
+
+    result = _mm256_blendv_pd(result, _mm256_set1_pd(-HUGE_VAL), _mm256_cmp_pd(x, _mm256_setzero_pd(), _CMP_EQ_OQ));
+    result = _mm256_blendv_pd(result, x, _mm256_cmp_pd(x, _mm256_set1_pd(HUGE_VAL), _CMP_EQ_OQ));
+    return _mm256_blendv_pd(result, _mm256_set1_pd(NAN), _mm256_cmp_pd(x, _mm256_setzero_pd(), _CMP_NGE_UQ));
+}
+
+#endif
+
+// kWidth 个 double 的向量; 标量构建时即为单个 double
+struct Vec {
+#if defined(YC_SIMD_AVX512)
+    __m512d v;
+    Vec(__m512d native) : v(native) {}
+    Vec(double x) : v(_mm512_set1_pd(x)) {}
+    static Vec load(const double* p) { return _mm512_loadu_pd(p); }
+    // 只读取前 n 个元素(n < kWidth), 其余为0
+    static Vec loadPartial(const double* p, size_t n) { return _mm512_maskz_loadu_pd(partialMask(n), p); }
+    void store(double* p) const { _mm512_storeu_pd(p, v); }
+    void storePartial(double* p, size_t n) const { _mm512_mask_storeu_pd(p, partialMask(n), v); }
+    static __mmask8 partialMask(size_t n) { return static_cast<__mmask8>((1u << n) - 1); }
+#elif defined(YC_SIMD_AVX2)
+    __m256d v;
+    Vec(__m256d native) : v(native) {}
+    Vec(double x) : v(_mm256_set1_pd(x)) {}
+    static Vec load(const double* p) { return _mm256_loadu_pd(p); }
+    static Vec loadPartial(const double* p, size_t n) { return _mm256_maskload_pd(p, partialMask(n)); }
+    void store(double* p) const { _mm256_storeu_pd(p, v); }
+    void storePartial(double* p, size_t n) const { _mm256_maskstore_pd(p, partialMask(n), v); }
+    // 掩码元素的符号位为1时读写
+    static __m256i partialMask(size_t n) {
+        return _mm256_cmpgt_epi64(_mm256_set1_epi64x(static_cast<long long>(n)), _mm256_setr_epi64x(0, 1, 2, 3));
+    }
+#else
+    double v;
+    Vec(double x) : v(x) {}
+    static Vec load(const double* p) { return *p; }
+    static Vec loadPartial(const double* p, size_t n) { return n ? *p : 0.0; }
+    void store(double* p) const { *p = v; }
+    void storePartial(double* p, size_t n) const { if (n) *p = v; }
+#endif
+    Vec() = default;
+};
+
+#if defined(YC_SIMD_AVX512)
+inline Vec operator+(Vec a, Vec b) { return _mm512_add_pd(a.v, b.v); }
+inline Vec operator-(Vec a, Vec b) { return _mm512_sub_pd(a.v, b.v); }
+inline Vec operator-(Vec a) { return _mm512_sub_pd(_mm512_setzero_pd(), a.v); }
+inline Vec operator*(Vec a, Vec b) { return _mm512_mul_pd(a.v, b.v); }
+inline Vec operator/(Vec a, Vec b) { return _mm512_div_pd(a.v, b.v); }
+inline Vec fmadd(Vec a, Vec b, Vec c) { return _mm512_fmadd_pd(a.v, b.v, c.v); }
+inline Vec min(Vec a, Vec b) { return _mm512_min_pd(a.v, b.v); }
+inline Vec max(Vec a, Vec b) { return _mm512_max_pd(a.v, b.v); }
+inline Vec exp(Vec a) { return exp(a.v); }
+inline Vec log(Vec a) { return log(a.v); }
+inline double sum(Vec a) { return _mm512_reduce_add_pd(a.v); }
+// cond 非0的元素取 a, 否则取 b
+inline Vec select(Vec cond, Vec a, Vec b) {
+    return _mm512_mask_mov_pd(b.v, _mm512_cmp_pd_mask(cond.v, _mm512_setzero_pd(), _CMP_NEQ_UQ), a.v);
+}
+#elif defined(YC_SIMD_AVX2)
+inline Vec operator+(Vec a, Vec b) { return _mm256_add_pd(a.v, b.v); }
+inline Vec operator-(Vec a, Vec b) { return _mm256_sub_pd(a.v, b.v); }
+inline Vec operator-(Vec a) { return _mm256_sub_pd(_mm256_setzero_pd(), a.v); }
+inline Vec operator*(Vec a, Vec b) { return _mm256_mul_pd(a.v, b.v); }
+inline Vec operator/(Vec a, Vec b) { return _mm256_div_pd(a.v, b.v); }
+inline Vec fmadd(Vec a, Vec b, Vec c) { return fmadd(a.v, b.v, c.v); }
+inline Vec min(Vec a, Vec b) { return _mm256_min_pd(a.v, b.v); }
+inline Vec max(Vec a, Vec b) { return _mm256_max_pd(a.v, b.v); }
+inline Vec exp(Vec a) { return exp(a.v); }
+inline Vec log(Vec a) { return log(a.v); }
+inline double sum(Vec a) {
+    __m128d half = _mm_add_pd(_mm256_castpd256_pd128(a.v), _mm256_extractf128_pd(a.v, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(half, _mm_unpackhi_pd(half, half)));
+}
+inline Vec select(Vec cond, Vec a, Vec b) {
+    return _mm256_blendv_pd(b.v, a.v, _mm256_cmp_pd(cond.v, _mm256_setzero_pd(), _CMP_NEQ_UQ));
+}
+#else
+inline Vec operator+(Vec a, Vec b) { return a.v + b.v; }
+inline Vec operator-(Vec a, Vec b) { return a.v - b.v; }
+inline Vec operator-(Vec a) { return -a.v; }
+inline Vec operator*(Vec a, Vec b) { return a.v * b.v; }
+inline Vec operator/(Vec a, Vec b) { return a.v / b.v; }
+inline Vec fmadd(Vec a, Vec b, Vec c) { return a.v * b.v + c.v; }
+inline Vec min(Vec a, Vec b) { return a.v < b.v ? a.v : b.v; }
+inline Vec max(Vec a, Vec b) { return a.v > b.v ? a.v : b.v; }
+inline Vec exp(Vec a) { return std::exp(a.v); }
+inline Vec log(Vec a) { return std::log(a.v); }
+inline double sum(Vec a) { return a.v; }
+inline Vec select(Vec cond, Vec a, Vec b) { return cond.v != 0.0 ? a : b; }
+#endif
+
+constexpr double kLn10 = 2.30258509299404568402;
+constexpr double kLog10e = 0.43429448190325182765;
+
+inline Vec log10(Vec a) { return log(a) * Vec(kLog10e); }
+inline Vec pow10(Vec a) { return exp(a * Vec(kLn10)); }
+
+} // namespace simd
@@ -0,0 +1,114 @@
+#include "SpeciesTable.h"
+#include <stdexcept>
+
+namespace {
+
+// FNV-1a
+uint64_t hashName(std::string_view name) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (char c : name) {
+        hash = (hash ^ static_cast<unsigned char>(c)) * 0x100000001b3ULL;
+    }
+    // 名称通常很短, 低位混合不充分; 取模前再混合一次高位
+    return hash ^ (hash >> 29);
+}
+
+} // namespace
+
+SpeciesTable::SpeciesTable(const std::vector<std::string>& names) {
+    m_names.reserve(names.size());
+    m_hashes.reserve(names.size());
+    rehash(names.size() * 2);
+    for (const auto& name : names) {
+        size_t before = size();
+        add(name);
+        if (size() == before) {
+            throw std::runtime_error("重复的物种 '" + name + "'");
+        }
+    }
+}
+
+uint32_t SpeciesTable::add(std::string_view name) {
+    uint32_t existing = find(name);
+    if (existing != npos) return existing;
+
+    if ((size() + 1) * 2 > m_slots.size()) {
+        rehash((size() + 1) * 2);
+    }
+
+    uint32_t index = static_cast<uint32_t>(m_names.size());
+    uint64_t hash = hashName(name);
+    m_names.emplace_back(name);
+    m_hashes.push_back(hash);
+
+    size_t mask = m_slots.size() - 1;
+    size_t slot = hash & mask;
+    while (m_slots[slot] != 0) slot = (slot + 1) & mask;
+    m_slots[slot] = index + 1;
+    return index;
+}
+
+uint32_t SpeciesTable::append(std::string_view name) {
+    if (name.empty() || contains(name)) {
+        uint32_t index = static_cast<uint32_t>(m_names.size());
+        if (!name.empty()) m_duplicates.push_back(index);
+        m_unindexed.push_back(index);
+        m_names.emplace_back(name);
+        m_hashes.push_back(hashName(name));
+        return index;
+    }
+    return add(name);
+}
+
+void SpeciesTable::requireUnique() const {
+    if (!unique()) {
+        throw std::runtime_error("重复的物种 '" + m_names[m_duplicates.front()] + "'");
+    }
+}
+
+uint32_t SpeciesTable::find(std::string_view name) const {
+    if (m_slots.empty()) return npos;
+
+    uint64_t hash = hashName(name);
+    size_t mask = m_slots.size() - 1;
+    for (size_t slot = hash & mask; m_slots[slot] != 0; slot = (slot + 1) & mask) {
+        uint32_t index = m_slots[slot] - 1;
+        if (m_hashes[index] == hash && m_names[index] == name) return index;
+    }
+    return npos;
+}
+
+uint32_t SpeciesTable::at(std::string_view name) const {
+    uint32_t index = find(name);
+    if (index == npos) {
+        throw std::runtime_error("未知物种 '" + std::string(name) + "'");
+    }
+    return index;
+}
+
+void SpeciesTable::clear() {
+    m_names.clear();
+    m_hashes.clear();
+    m_slots.clear();
+    m_duplicates.clear();
+    m_unindexed.clear();
+}
+
+void SpeciesTable::rehash(size_t slotCount) {
+    size_t capacity = 16;
+    while (capacity < slotCount) capacity *= 2;
+    if (capacity <= m_slots.size()) return;
+
+    m_slots.assign(capacity, 0);
+    size_t mask = capacity - 1;
+    size_t skip = 0;            // m_unindexed 按下标升序
+    for (size_t index = 0; index < m_names.size(); index++) {
+        if (skip < m_unindexed.size() && m_unindexed[skip] == index) {
+            skip++;
+            continue;
+        }
+        size_t slot = m_hashes[index] & mask;
+        while (m_slots[slot] != 0) slot = (slot + 1) & mask;
+        m_slots[slot] = static_cast<uint32_t>(index + 1);
+    }
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// ========== 物种表 ==========
+// 为每个物种分配从0开始的连续下标, 编译后的数据(动力学、化学计量矩阵等)只保存下标.
+// 查找使用开放寻址(线性探测)哈希表: 槽位数为2的幂且不少于物种数的2倍, 每个槽只存下标,
+// 比较前先比较缓存的哈希值, 查找时不分配内存(参数为 std::string_view)
+
+class SpeciesTable {
+public:
+    static constexpr uint32_t npos = UINT32_MAX;
+
+    SpeciesTable() = default;
+    // 按顺序添加 names, 出现重复名称时抛出 std::runtime_error
+    explicit SpeciesTable(const std::vector<std::string>& names);
+
+    // 添加物种, 返回其下标; 已存在时返回原有下标
+    uint32_t add(std::string_view name);
+    // 按位置追加物种, 总是分配新下标. 名称已存在时记入 duplicates(), 查找仍返回先出现的下标;
+    // 空名称不参与查找
+    uint32_t append(std::string_view name);
+
+    // append 时名称重复的下标
+    const std::vector<uint32_t>& duplicates() const { return m_duplicates; }
+    bool unique() const { return m_duplicates.empty(); }
+    // 需要名称与下标一一对应的使用方调用: 有重复名称时抛出 std::runtime_error
+    void requireUnique() const;
+
+    // 物种下标, 不存在时返回 npos
+    uint32_t find(std::string_view name) const;
+    // 物种下标, 不存在时抛出 std::runtime_error
+    uint32_t at(std::string_view name) const;
+    bool contains(std::string_view name) const { return find(name) != npos; }
+
+    size_t size() const { return m_names.size(); }
+    bool empty() const { return m_names.empty(); }
+    const std::string& name(uint32_t index) const { return m_names[index]; }
+    const std::vector<std::string>& names() const { return m_names; }
+
+    void clear();
+
+private:
+    void rehash(size_t slotCount);
+
+    std::vector<std::string> m_names;
+    std::vector<uint64_t> m_hashes;     // 与 m_names 对应
+    std::vector<uint32_t> m_slots;      // 物种下标 + 1, 0 为空槽
+    std::vector<uint32_t> m_duplicates;
+    std::vector<uint32_t> m_unindexed;  // append 的重复名称和空名称, 不放入 m_slots
+};
@@ -0,0 +1,125 @@
+#include "StoichiometricMatrix.h"
+#include "EquationTokenizer.h"
+#include <map>
+#include <stdexcept>
+
+namespace {
+
+// 把 terms[begin, end) 追加为一行, 行内按物种下标升序
+void appendRow(SparseMatrix& matrix, const std::vector<EquationTerm>& terms, size_t begin, size_t end,
+    const SpeciesTable& species, size_t i) {
+    std::map<uint32_t, double> sorted;
+    for (size_t t = begin; t < end; t++) {
+        uint32_t k = species.find(terms[t].species);
+        if (k == SpeciesTable::npos) {
+            throw std::runtime_error("反应 " + std::to_string(i) + ": 未知物种 '" + std::string(terms[t].species) + "'");
+        }
+        sorted[k] += terms[t].stoich;
+    }
+    for (const auto& [k, stoich] : sorted) {
+        matrix.indices.push_back(k);
+        matrix.values.push_back(stoich);
+    }
+    matrix.offsets.push_back(static_cast<uint32_t>(matrix.indices.size()));
+}
+
+} // namespace
+
+SparseMatrix SparseMatrix::transposed() const {
+    SparseMatrix result;
+    result.rows = cols;
+    result.cols = rows;
+    result.offsets.assign(cols + 1, 0);
+    result.indices.resize(nonZeros());
+    result.values.resize(nonZeros());
+
+    for (uint32_t c : indices) result.offsets[c + 1]++;
+    for (size_t c = 0; c < cols; c++) result.offsets[c + 1] += result.offsets[c];
+
+    // 按行顺序填入, 转置后每行内的列号自然升序
+    std::vector<uint32_t> next(result.offsets.begin(), result.offsets.end() - 1);
+    for (size_t r = 0; r < rows; r++) {
+        for (uint32_t e = offsets[r]; e < offsets[r + 1]; e++) {
+            uint32_t slot = next[indices[e]]++;
+            result.indices[slot] = static_cast<uint32_t>(r);
+            result.values[slot] = values[e];
+        }
+    }
+    return result;
+}
+
+StoichiometricMatrix::StoichiometricMatrix(const std::vector<ReactionData>& reactions,
+    const SpeciesTable& species) {
+    species.requireUnique();
+    for (SparseMatrix* matrix : { &m_reactants, &m_products }) {
+        matrix->rows = reactions.size();
+        matrix->cols = species.size();
+        matrix->offsets.reserve(reactions.size() + 1);
+        matrix->offsets.push_back(0);
+    }
+    m_reversible.resize(reactions.size());
+
+    std::vector<EquationTerm> terms;
+    for (size_t i = 0; i < reactions.size(); i++) {
+        ParsedEquation parsed;
+        try {
+            parsed = tokenizeEquation(reactions[i].equation, terms);
+        }
+        catch (const std::exception& e) {
+            throw std::runtime_error("反应 " + std::to_string(i) + ": " + e.what());
+        }
+
+        appendRow(m_reactants, terms, 0, parsed.reactantCount, species, i);
+        appendRow(m_products, terms, parsed.reactantCount, terms.size(), species, i);
+        m_reversible[i] = parsed.reversible ? 1 : 0;
+    }
+
+    m_reactantsBySpecies = m_reactants.transposed();
+    m_productsBySpecies = m_products.transposed();
+
+    // 净化学计量数: 按物种合并两个 CSC 行(均按反应下标升序)
+    SparseMatrix& net = m_netBySpecies;
+    net.rows = species.size();
+    net.cols = reactions.size();
+    net.offsets.reserve(net.rows + 1);
+    net.offsets.push_back(0);
+    for (size_t k = 0; k < net.rows; k++) {
+        uint32_t a = m_reactantsBySpecies.offsets[k];
+        uint32_t aEnd = m_reactantsBySpecies.offsets[k + 1];
+        uint32_t b = m_productsBySpecies.offsets[k];
+        uint32_t bEnd = m_productsBySpecies.offsets[k + 1];
+        while (a < aEnd || b < bEnd) {
+            uint32_t ra = a < aEnd ? m_reactantsBySpecies.indices[a] : UINT32_MAX;
+            uint32_t rb = b < bEnd ? m_productsBySpecies.indices[b] : UINT32_MAX;
+            uint32_t r = ra < rb ? ra : rb;
+            double value = 0.0;
+            if (ra == r) value -= m_reactantsBySpecies.values[a++];
+            if (rb == r) value += m_productsBySpecies.values[b++];
+            if (value != 0.0) {
+                net.indices.push_back(r);
+                net.values.push_back(value);
+            }
+        }
+        net.offsets.push_back(static_cast<uint32_t>(net.indices.size()));
+    }
+}
+
+StoichiometricMatrix::StoichiometricMatrix(const std::vector<ReactionData>& reactions,
+    const std::vector<std::string>& speciesNames)
+    : StoichiometricMatrix(reactions, SpeciesTable(speciesNames)) {
+}
+
+StoichiometricMatrix::StoichiometricMatrix(const MechanismData& mechanism)
+    : StoichiometricMatrix(mechanism.reactions, mechanism.species) {
+}
+
+void StoichiometricMatrix::productionRates(const double* rates, double* wdot) const {
+    const SparseMatrix& net = m_netBySpecies;
+    for (size_t k = 0; k < net.rows; k++) {
+        double sum = 0.0;
+        for (uint32_t e = net.offsets[k]; e < net.offsets[k + 1]; e++) {
+            sum += net.values[e] * rates[net.indices[e]];
+        }
+        wdot[k] = sum;
+    }
+}
@@ -0,0 +1,61 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Mechanism.h"
+
+// ========== 化学计量矩阵 ==========
+// 反应方程只解析一次, 编译为以物种下标为列的稀疏矩阵, 后续计算只做稀疏读取和累加.
+
+// 按行压缩的稀疏矩阵: 第 i 行的元素为 [offsets[i], offsets[i+1]), 行内列号升序
+struct SparseMatrix {
+    size_t rows = 0;
+    size_t cols = 0;
+    std::vector<uint32_t> offsets;  // [rows + 1]
+    std::vector<uint32_t> indices;  // 列号
+    std::vector<double> values;
+
+    size_t nonZeros() const { return indices.size(); }
+    // 转置(CSR 与 CSC 互换)
+    SparseMatrix transposed() const;
+};
+
+class StoichiometricMatrix {
+public:
+    StoichiometricMatrix() = default;
+    // species 给出物种下标; species 中有重复名称或方程中出现未知物种时抛出 std::runtime_error(信息中包含反应下标).
+    // 三体 "M" 和衰减碰撞体 "(+M)"/"(+AR)" 不计入化学计量数
+    StoichiometricMatrix(const std::vector<ReactionData>& reactions, const SpeciesTable& species);
+    // 物种下标为 speciesNames 中的位置(名称不能重复)
+    StoichiometricMatrix(const std::vector<ReactionData>& reactions, const std::vector<std::string>& speciesNames);
+    // 物种下标取 mechanism.species
+    explicit StoichiometricMatrix(const MechanismData& mechanism);
+
+    size_t reactionCount() const { return m_reactants.rows; }
+    size_t speciesCount() const { return m_reactants.cols; }
+
+    // 按反应(CSR, 行为反应): ν'_rk、ν''_rk
+    const SparseMatrix& reactants() const { return m_reactants; }
+    const SparseMatrix& products() const { return m_products; }
+    // 按物种(CSC, 行为物种)
+    const SparseMatrix& reactantsBySpecies() const { return m_reactantsBySpecies; }
+    const SparseMatrix& productsBySpecies() const { return m_productsBySpecies; }
+    // 净化学计量数 ν''-ν', 按物种; 两侧相同的物种(如催化剂)抵消后不保存
+    const SparseMatrix& netBySpecies() const { return m_netBySpecies; }
+
+    // "<=>" 或 "=" 为可逆反应, "=>" 为不可逆反应
+    bool isReversible(size_t reaction) const { return m_reversible[reaction] != 0; }
+    const std::vector<uint8_t>& reversible() const { return m_reversible; }
+
+    // 物种生成速率: wdot[k] = Σ_r (ν''_rk - ν'_rk) * rates[r], rates 为各反应的净速率
+    void productionRates(const double* rates, double* wdot) const;
+
+private:
+    SparseMatrix m_reactants;
+    SparseMatrix m_products;
+    SparseMatrix m_reactantsBySpecies;
+    SparseMatrix m_productsBySpecies;
+    SparseMatrix m_netBySpecies;
+    std::vector<uint8_t> m_reversible;
+};
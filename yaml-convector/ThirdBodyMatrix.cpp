@@ -0,0 +1,101 @@
+#include "ThirdBodyMatrix.h"
+#include "SimdMath.h"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+// 每块的状态数
+constexpr size_t kStateBlock = 64;
+
+std::vector<uint32_t> thirdBodyReactions(const CompiledKinetics& kinetics) {
+    std::vector<uint32_t> reactions;
+    for (size_t i = 0; i < kinetics.reactionCount(); i++) {
+        if (kinetics.type[i] != ReactionType::Elementary) {
+            reactions.push_back(static_cast<uint32_t>(i));
+        }
+    }
+    return reactions;
+}
+
+} // namespace
+
+ThirdBodyMatrix::ThirdBodyMatrix(const CompiledKinetics& kinetics)
+    : ThirdBodyMatrix(kinetics, thirdBodyReactions(kinetics)) {
+}
+
+ThirdBodyMatrix::ThirdBodyMatrix(const CompiledKinetics& kinetics, const std::vector<uint32_t>& reactions)
+    : m_speciesCount(kinetics.speciesCount), m_reactions(reactions) {
+    m_defaultEfficiency.reserve(reactions.size());
+    m_offsets.reserve(reactions.size() + 1);
+    m_offsets.push_back(0);
+
+    for (uint32_t i : reactions) {
+        if (i >= kinetics.reactionCount()) {
+            throw std::runtime_error("ThirdBodyMatrix: 反应下标越界 " + std::to_string(i));
+        }
+        const double defaultEfficiency = kinetics.defaultEfficiency[i];
+        m_defaultEfficiency.push_back(defaultEfficiency);
+        for (uint32_t e = kinetics.efficiencyOffsets[i]; e < kinetics.efficiencyOffsets[i + 1]; e++) {
+            double delta = kinetics.efficiencyValues[e] - defaultEfficiency;
+            if (delta == 0.0) continue;
+            m_species.push_back(kinetics.efficiencySpecies[e]);
+            m_values.push_back(delta);
+        }
+        m_offsets.push_back(static_cast<uint32_t>(m_species.size()));
+    }
+}
+
+void ThirdBodyMatrix::evaluate(const double* concentrations, double* M) const {
+    double total = 0.0;
+    for (size_t k = 0; k < m_speciesCount; k++) total += concentrations[k];
+
+    const size_t rows = size();
+    for (size_t r = 0; r < rows; r++) {
+        double value = m_defaultEfficiency[r] * total;
+        for (uint32_t e = m_offsets[r]; e < m_offsets[r + 1]; e++) {
+            value += m_values[e] * concentrations[m_species[e]];
+        }
+        M[r] = value;
+    }
+}
+
+void ThirdBodyMatrix::evaluate(const double* concentrations, size_t stateCount, double* M) const {
+    for (size_t begin = 0; begin < stateCount; begin += kStateBlock) {
+        evaluateBlock(concentrations, stateCount, begin, std::min(begin + kStateBlock, stateCount), M);
+    }
+}
+
+void ThirdBodyMatrix::evaluateBlock(const double* concentrations, size_t stateCount, size_t begin, size_t end,
+    double* M) const {
+    using simd::Vec;
+    const size_t count = end - begin;
+
+    // 对块内每个状态做 y += w * x, 按向量宽度处理
+    auto axpy = [count](double* y, Vec w, const double* x) {
+        size_t s = 0;
+        for (; s + simd::kWidth <= count; s += simd::kWidth) {
+            fmadd(w, Vec::load(x + s), Vec::load(y + s)).store(y + s);
+        }
+        if (s < count) {
+            const size_t rest = count - s;
+            fmadd(w, Vec::loadPartial(x + s, rest), Vec::loadPartial(y + s, rest)).storePartial(y + s, rest);
+        }
+    };
+
+    double total[kStateBlock] = {};
+    for (size_t k = 0; k < m_speciesCount; k++) {
+        axpy(total, 1.0, concentrations + k * stateCount + begin);
+    }
+
+    const size_t rows = size();
+    for (size_t r = 0; r < rows; r++) {
+        double* row = M + r * stateCount + begin;
+        std::fill(row, row + count, 0.0);
+        axpy(row, m_defaultEfficiency[r], total);
+        for (uint32_t e = m_offsets[r]; e < m_offsets[r + 1]; e++) {
+            axpy(row, m_values[e], concentrations + m_species[e] * stateCount + begin);
+        }
+    }
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "CompiledKinetics.h"
+
+// ========== 第三体浓度 [M] ==========
+// [M]_r = Σ_k eff_rk * C_k. 每行只保存与默认效率不同的物种, 因此写成
+//   [M]_r = d_r * Σ_k C_k + Σ_{k 在第 r 行} (eff_rk - d_r) * C_k
+// d_r 通常为1; 指定碰撞体(如 "(+AR)")的反应 d_r 为0, 该物种的差值为1.
+// 一行对应一个三体或衰减反应, 行顺序可由调用方指定(例如与 FalloffKernel::reactions() 一致).
+class ThirdBodyMatrix {
+public:
+    ThirdBodyMatrix() = default;
+    // 全部三体和衰减反应, 按反应下标升序
+    explicit ThirdBodyMatrix(const CompiledKinetics& kinetics);
+    // 指定反应及其行顺序
+    ThirdBodyMatrix(const CompiledKinetics& kinetics, const std::vector<uint32_t>& reactions);
+
+    size_t size() const { return m_reactions.size(); }
+    size_t speciesCount() const { return m_speciesCount; }
+    size_t nonZeros() const { return m_species.size(); }
+    // 第 r 行对应的反应下标
+    const std::vector<uint32_t>& reactions() const { return m_reactions; }
+
+    // 单个状态: concentrations[k] [kmol/m^3] -> M[r]
+    void evaluate(const double* concentrations, double* M) const;
+    // 一批状态, 按物种存放: concentrations[k * stateCount + s] -> M[r * stateCount + s].
+    // 每次处理一块状态, 矩阵对整块只读取一次. 行顺序与 FalloffKernel::reactions() 一致时,
+    // 结果可直接作为 FalloffKernel 批量计算的输入
+    void evaluate(const double* concentrations, size_t stateCount, double* M) const;
+
+private:
+    void evaluateBlock(const double* concentrations, size_t stateCount, size_t begin, size_t end, double* M) const;
+
+    size_t m_speciesCount = 0;
+    std::vector<uint32_t> m_reactions;
+    std::vector<double> m_defaultEfficiency;
+    std::vector<uint32_t> m_offsets;    // [行数 + 1]
+    std::vector<uint32_t> m_species;
+    std::vector<double> m_values;       // eff - 默认效率
+};
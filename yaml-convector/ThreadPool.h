@@ -0,0 +1,70 @@
+#pragma once
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//固定大小的线程池: 任务按提交顺序取出执行, 析构时等待已提交的任务完成
+class ThreadPool {
+public:
+    // threads 为0时使用 std::thread::hardware_concurrency()
+    explicit ThreadPool(size_t threads = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    size_t size() const { return m_workers.size(); }
+
+    // 提交任务, 返回的 future 在任务完成时就绪, 任务抛出的异常由 future.get() 重新抛出
+    template <typename Func>
+    auto submit(Func&& func) -> std::future<decltype(func())> {
+        using Result = decltype(func());
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Func>(func));
+        std::future<Result> result = task->get_future();
+        enqueue([task]() { (*task)(); });
+        return result;
+    }
+
+    // 把 [0, count) 切成大小为 chunkSize 的区间, 并行调用 body(begin, end) 并等待全部完成.
+    // 任一区间抛出异常时, 等其余区间结束后重新抛出第一个(按区间顺序)异常
+    template <typename Func>
+    void parallelFor(size_t count, size_t chunkSize, Func&& body) {
+        if (chunkSize == 0) chunkSize = 1;
+        std::vector<std::future<void>> chunks;
+        chunks.reserve((count + chunkSize - 1) / chunkSize);
+        for (size_t begin = 0; begin < count; begin += chunkSize) {
+            size_t end = std::min(count, begin + chunkSize);
+            chunks.push_back(submit([&body, begin, end]() { body(begin, end); }));
+        }
+
+        std::exception_ptr firstError;
+        for (auto& chunk : chunks) {
+            try {
+                chunk.get();
+            }
+            catch (...) {
+                if (!firstError) firstError = std::current_exception();
+            }
+        }
+        if (firstError) std::rethrow_exception(firstError);
+    }
+
+    // 默认的区间大小: 每个线程约分到 chunksPerThread 个区间, 且每个区间不少于 minChunk 个元素
+    size_t chunkSizeFor(size_t count, size_t minChunk = 16, size_t chunksPerThread = 4) const;
+
+private:
+    void enqueue(std::function<void()> task);
+    void workerLoop();
+
+    std::vector<std::thread> m_workers;
+    std::deque<std::function<void()>> m_tasks;
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    bool m_stopping = false;
+};
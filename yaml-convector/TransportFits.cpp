@@ -0,0 +1,405 @@
+#include "TransportFits.h"
+#include "Elements.h"
+#include "Nasa7Thermo.h"
+#include "Nasa9Thermo.h"
+#include "PhysicalConstants.h"
+#include "SimdMath.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+
+constexpr size_t kFitPoints = 50;
+
+// 1 Debye [C·m]
+constexpr double kDebye = 1e-21 / LightSpeed;
+
+// 换算为SI单位的分子参数
+struct MolecularParameters {
+    double weight;          // kg/kmol
+    double diameter;        // m
+    double wellDepth;       // J
+    double dipole;          // C·m
+    double polarizability;  // m^3
+    double rotationalRelaxation;
+    double rotationalCv;    // Cv_rot/R: 原子0, 线性分子1, 非线性分子1.5
+};
+
+double rotationalCvOf(const TransportData& transport) {
+    if (transport.geometry == "atom") return 0.0;
+    if (transport.geometry == "linear") return 1.0;
+    if (transport.geometry == "nonlinear") return 1.5;
+    throw std::runtime_error("物种 '" + transport.name + "': 未知的 geometry '" + transport.geometry + "'");
+}
+
+// Lennard-Jones 约化碰撞积分(Neufeld, Janzen, Aziz 1972), 0.3 <= T* <= 100 内误差约 0.1%
+double omega11LJ(double Tstar) {
+    return 1.06036 / std::pow(Tstar, 0.15610) + 0.19300 * std::exp(-0.47635 * Tstar)
+        + 1.03587 * std::exp(-1.52996 * Tstar) + 1.76474 * std::exp(-3.89411 * Tstar);
+}
+
+double omega22LJ(double Tstar) {
+    return 1.16145 / std::pow(Tstar, 0.14874) + 0.52487 * std::exp(-0.77320 * Tstar)
+        + 2.16178 * std::exp(-2.43787 * Tstar)
+        - 6.435e-4 * std::pow(Tstar, 0.14874) * std::sin(18.0323 * std::pow(Tstar, -0.76830) - 7.27371);
+}
+
+// Parker 公式中转动松弛数随温度变化的因子, Zrot(T) = Zrot(298) F(298)/F(T)
+double parkerFactor(double Tstar) {
+    const double x = 1.0 / Tstar;
+    return 1.0 + 0.5 * std::pow(Pi, 1.5) * std::sqrt(x) + (0.25 * Pi * Pi + 2.0) * x + std::pow(Pi, 1.5) * x * std::sqrt(x);
+}
+
+// 约化偶极矩 δ* = μ^2 / (2 ε σ^3 4πε0)
+double reducedDipole(double dipole, double wellDepth, double diameter) {
+    return 0.5 * dipole * dipole / (4.0 * Pi * Epsilon0 * wellDepth * diameter * diameter * diameter);
+}
+
+// 加权最小二乘多项式拟合(Householder QR): 使 Σ w_i (p(x_i) - y_i)^2 最小, coeffs 按升幂
+void fitPolynomial(const double* x, const double* y, const double* w, size_t n, double* coeffs) {
+    constexpr size_t m = TransportFits::kCoeffCount;
+    double A[kFitPoints][m];
+    double b[kFitPoints];
+    for (size_t i = 0; i < n; i++) {
+        double s = std::sqrt(w[i]);
+        double p = s;
+        for (size_t c = 0; c < m; c++) {
+            A[i][c] = p;
+            p *= x[i];
+        }
+        b[i] = s * y[i];
+    }
+
+    double v[kFitPoints];
+    for (size_t c = 0; c < m; c++) {
+        double norm = 0.0;
+        for (size_t i = c; i < n; i++) norm += A[i][c] * A[i][c];
+        norm = std::sqrt(norm);
+        if (norm == 0.0) continue;
+
+        // v = a - alpha*e, 取 alpha 与 a[c] 异号以避免相消
+        double alpha = A[c][c] > 0.0 ? -norm : norm;
+        double vNorm2 = 0.0;
+        for (size_t i = c; i < n; i++) {
+            v[i] = A[i][c] - (i == c ? alpha : 0.0);
+            vNorm2 += v[i] * v[i];
+        }
+
+        for (size_t col = c; col < m; col++) {
+            double dot = 0.0;
+            for (size_t i = c; i < n; i++) dot += v[i] * A[i][col];
+            double f = 2.0 * dot / vNorm2;
+            for (size_t i = c; i < n; i++) A[i][col] -= f * v[i];
+        }
+        double dot = 0.0;
+        for (size_t i = c; i < n; i++) dot += v[i] * b[i];
+        double f = 2.0 * dot / vNorm2;
+        for (size_t i = c; i < n; i++) b[i] -= f * v[i];
+    }
+
+    for (size_t c = m; c-- > 0;) {
+        double s = b[c];
+        for (size_t j = c + 1; j < m; j++) s -= A[c][j] * coeffs[j];
+        coeffs[c] = s / A[c][c];
+    }
+}
+
+double evaluatePolynomial(const double* coeffs, double x) {
+    double p = coeffs[TransportFits::kDegree];
+    for (size_t c = TransportFits::kDegree; c-- > 0;) p = p * x + coeffs[c];
+    return p;
+}
+
+// 热力学数据的温度范围, 没有数据时返回 false
+bool thermoRange(const ThermoData& thermo, double& Tmin, double& Tmax) {
+    if (thermo.coefficients.low.size() == 7 && thermo.temperatureRanges.size() >= 2) {
+        Tmin = thermo.temperatureRanges.front();
+        Tmax = thermo.temperatureRanges.back();
+        return true;
+    }
+    if (!thermo.nasa9Coeffs.empty() && thermo.nasa9Coeffs.front().temperatureRange.size() == 2
+        && thermo.nasa9Coeffs.back().temperatureRange.size() == 2) {
+        Tmin = thermo.nasa9Coeffs.front().temperatureRange[0];
+        Tmax = thermo.nasa9Coeffs.back().temperatureRange[1];
+        return true;
+    }
+    return false;
+}
+
+} // namespace
+
+double collisionIntegral11(double Tstar, double deltaStar) {
+    // Brokaw(1969) 的 Stockmayer 修正
+    return omega11LJ(Tstar) + 0.19 * deltaStar * deltaStar / Tstar;
+}
+
+double collisionIntegral22(double Tstar, double deltaStar) {
+    return omega22LJ(Tstar) + 0.2 * deltaStar * deltaStar / Tstar;
+}
+
+TransportFits::TransportFits(const MechanismData& mechanism) {
+    const size_t count = mechanism.transportSpecies.size();
+    m_species = mechanism.transportSpeciesIndex;
+    m_molecularWeight.resize(count);
+
+    std::vector<MolecularParameters> params(count);
+    m_Tmin = 0.0;
+    m_Tmax = 1e300;
+    for (size_t k = 0; k < count; k++) {
+        const TransportData& transport = mechanism.transportSpecies[k];
+        if (m_species[k] >= mechanism.thermoSpecies.size()) {
+            throw std::runtime_error("物种 '" + transport.name + "': 缺少热力学数据");
+        }
+        const ThermoData& thermo = mechanism.thermoSpecies[m_species[k]];
+        double Tmin = 0.0;
+        double Tmax = 0.0;
+        if (!thermoRange(thermo, Tmin, Tmax)) {
+            throw std::runtime_error("物种 '" + transport.name + "': 缺少 NASA7/NASA9 热力学数据");
+        }
+        m_Tmin = std::max(m_Tmin, Tmin);
+        m_Tmax = std::min(m_Tmax, Tmax);
+
+        if (transport.diameter <= 0.0 || transport.wellDepth <= 0.0) {
+            throw std::runtime_error("物种 '" + transport.name + "': diameter 和 well-depth 必须为正");
+        }
+        MolecularParameters& p = params[k];
+        p.weight = molecularWeight(thermo.composition);
+        p.diameter = transport.diameter * 1e-10;
+        p.wellDepth = transport.wellDepth * Boltzmann;
+        p.dipole = transport.dipole * kDebye;
+        p.polarizability = transport.polarizability * 1e-30;
+        p.rotationalRelaxation = transport.rotationalRelaxation;
+        p.rotationalCv = rotationalCvOf(transport);
+        m_molecularWeight[k] = p.weight;
+    }
+    // 各物种温度范围没有交集时使用常用范围
+    if (count == 0 || m_Tmin >= m_Tmax) {
+        m_Tmin = 300.0;
+        m_Tmax = 3000.0;
+    }
+
+    // 拟合温度点及各点的 cp/R
+    double T[kFitPoints];
+    double logT[kFitPoints];
+    for (size_t n = 0; n < kFitPoints; n++) {
+        T[n] = m_Tmin + (m_Tmax - m_Tmin) * n / (kFitPoints - 1);
+        logT[n] = std::log(T[n]);
+    }
+
+    std::vector<double> cpR(kFitPoints * count);
+    {
+        Nasa7Thermo nasa7(mechanism.thermoSpecies);
+        Nasa9Thermo nasa9(mechanism.thermoSpecies);
+        std::vector<int32_t> column7(mechanism.thermoSpecies.size(), -1);
+        std::vector<int32_t> column9(mechanism.thermoSpecies.size(), -1);
+        for (size_t c = 0; c < nasa7.size(); c++) column7[nasa7.species()[c]] = static_cast<int32_t>(c);
+        for (size_t c = 0; c < nasa9.size(); c++) column9[nasa9.species()[c]] = static_cast<int32_t>(c);
+
+        std::vector<double> cp7(nasa7.size());
+        std::vector<double> cp9(nasa9.size());
+        for (size_t n = 0; n < kFitPoints; n++) {
+            nasa7.evaluate(T[n], cp7.data(), nullptr, nullptr, nullptr);
+            nasa9.evaluate(T[n], cp9.data(), nullptr, nullptr, nullptr);
+            for (size_t k = 0; k < count; k++) {
+                int32_t c7 = column7[m_species[k]];
+                cpR[n * count + k] = c7 >= 0 ? cp7[c7] : cp9[column9[m_species[k]]];
+            }
+        }
+    }
+
+    m_stride = (count + simd::kWidth - 1) / simd::kWidth * simd::kWidth;
+    m_viscosity.assign(kCoeffCount * m_stride, 0.0);
+    m_conductivity.assign(kCoeffCount * m_stride, 0.0);
+    m_pairStride = (pairCount() + simd::kWidth - 1) / simd::kWidth * simd::kWidth;
+    m_diffusion.assign(kCoeffCount * m_pairStride, 0.0);
+    m_fitError = FitError();
+
+    double y[kFitPoints];
+    double w[kFitPoints];
+    double exact[kFitPoints];
+    double coeffs[kCoeffCount];
+    auto fit = [&](double* out, size_t outStride, double& maxError, auto&& value) {
+        fitPolynomial(logT, y, w, kFitPoints, coeffs);
+        for (size_t c = 0; c < kCoeffCount; c++) out[c * outStride] = coeffs[c];
+        for (size_t n = 0; n < kFitPoints; n++) {
+            double error = std::fabs(value(evaluatePolynomial(coeffs, logT[n]), n) - exact[n]) / exact[n];
+            maxError = std::max(maxError, error);
+        }
+    };
+
+    for (size_t k = 0; k < count; k++) {
+        const MolecularParameters& p = params[k];
+        const double delta = reducedDipole(p.dipole, p.wellDepth, p.diameter);
+        const double mass = p.weight / Avogadro;
+        const double sigma2 = p.diameter * p.diameter;
+        const double parker298 = parkerFactor(298.0 * Boltzmann / p.wellDepth);
+
+        double viscosity[kFitPoints];
+        double conductivity[kFitPoints];
+        for (size_t n = 0; n < kFitPoints; n++) {
+            const double Tstar = Boltzmann * T[n] / p.wellDepth;
+            const double om11 = collisionIntegral11(Tstar, delta);
+            const double om22 = collisionIntegral22(Tstar, delta);
+
+            const double eta = 5.0 / 16.0 * std::sqrt(Pi * mass * Boltzmann * T[n]) / (Pi * sigma2 * om22);
+            // 自扩散系数与压力之积 D_kk*P, 约化质量为 m/2
+            const double selfDiffusion = 3.0 / 16.0 * std::sqrt(2.0 * Pi / (0.5 * mass))
+                * std::pow(Boltzmann * T[n], 1.5) / (Pi * sigma2 * om11);
+
+            // Warnatz 模型: f_int = ρD_kk/η
+            const double fInt = p.weight / (GasConstant * T[n]) * selfDiffusion / eta;
+            const double cvRot = p.rotationalCv;
+            const double A = 2.5 - fInt;
+            const double B = p.rotationalRelaxation * parker298 / parkerFactor(Tstar) + 2.0 / Pi * (5.0 / 3.0 * cvRot + fInt);
+            const double c1 = 2.0 / Pi * A / B;
+            const double cvInt = cpR[n * count + k] - 2.5 - cvRot;
+            const double fRot = fInt * (1.0 + c1);
+            const double fTrans = 2.5 * (1.0 - c1 * cvRot / 1.5);
+
+            viscosity[n] = eta;
+            conductivity[n] = eta / p.weight * GasConstant * (fTrans * 1.5 + fRot * cvRot + fInt * cvInt);
+        }
+
+        // η 近似正比于 sqrt(T), 拟合 sqrt(η/sqrt(T)) 使多项式变化平缓
+        for (size_t n = 0; n < kFitPoints; n++) {
+            exact[n] = viscosity[n];
+            y[n] = std::sqrt(viscosity[n] / std::sqrt(T[n]));
+            w[n] = 1.0 / (y[n] * y[n]);
+        }
+        fit(m_viscosity.data() + k, m_stride, m_fitError.viscosity,
+            [&](double fitted, size_t n) { return fitted * fitted * std::sqrt(T[n]); });
+
+        for (size_t n = 0; n < kFitPoints; n++) {
+            exact[n] = conductivity[n];
+            y[n] = conductivity[n] / std::sqrt(T[n]);
+            w[n] = 1.0 / (y[n] * y[n]);
+        }
+        fit(m_conductivity.data() + k, m_stride, m_fitError.conductivity,
+            [&](double fitted, size_t n) { return fitted * std::sqrt(T[n]); });
+    }
+
+    // 二元扩散系数, 只拟合 j <= k
+    for (size_t j = 0; j < count; j++) {
+        for (size_t k = j; k < count; k++) {
+            const MolecularParameters& pj = params[j];
+            const MolecularParameters& pk = params[k];
+
+            // 极性-非极性分子对的修正: ε 乘 ξ^2, σ 乘 ξ^(-1/6)
+            double xi = 1.0;
+            bool polarJ = pj.dipole > 0.0;
+            bool polarK = pk.dipole > 0.0;
+            if (polarJ != polarK) {
+                const MolecularParameters& polar = polarJ ? pj : pk;
+                const MolecularParameters& nonpolar = polarJ ? pk : pj;
+                double alphaStar = nonpolar.polarizability / std::pow(nonpolar.diameter, 3);
+                double muStar = polar.dipole / std::sqrt(4.0 * Pi * Epsilon0 * std::pow(polar.diameter, 3) * polar.wellDepth);
+                xi = 1.0 + 0.25 * alphaStar * muStar * muStar * std::sqrt(polar.wellDepth / nonpolar.wellDepth);
+            }
+            const double wellDepth = xi * xi * std::sqrt(pj.wellDepth * pk.wellDepth);
+            const double diameter = 0.5 * (pj.diameter + pk.diameter) * std::pow(xi, -1.0 / 6.0);
+            const double delta = reducedDipole(std::sqrt(pj.dipole * pk.dipole), wellDepth, diameter);
+            const double reducedMass = pj.weight * pk.weight / (pj.weight + pk.weight) / Avogadro;
+
+            for (size_t n = 0; n < kFitPoints; n++) {
+                const double Tstar = Boltzmann * T[n] / wellDepth;
+                const double om11 = collisionIntegral11(Tstar, delta);
+                // D_jk * P
+                exact[n] = 3.0 / 16.0 * std::sqrt(2.0 * Pi / reducedMass) * std::pow(Boltzmann * T[n], 1.5)
+                    / (Pi * diameter * diameter * om11);
+                y[n] = exact[n] / std::pow(T[n], 1.5);
+                w[n] = 1.0 / (y[n] * y[n]);
+            }
+            fit(m_diffusion.data() + pairIndex(j, k), m_pairStride, m_fitError.diffusion,
+                [&](double fitted, size_t n) { return fitted * std::pow(T[n], 1.5); });
+        }
+    }
+}
+
+void TransportFits::viscosity(double T, double* eta) const {
+    using simd::Vec;
+    const Vec logT = std::log(T);
+    const Vec sqrtT = std::sqrt(T);
+    const size_t count = size();
+    for (size_t k = 0; k < count; k += simd::kWidth) {
+        Vec p = Vec::load(m_viscosity.data() + kDegree * m_stride + k);
+        for (size_t c = kDegree; c-- > 0;) {
+            p = fmadd(p, logT, Vec::load(m_viscosity.data() + c * m_stride + k));
+        }
+        Vec value = p * p * sqrtT;
+        const size_t n = count - k;
+        if (n >= simd::kWidth) value.store(eta + k);
+        else value.storePartial(eta + k, n);
+    }
+}
+
+void TransportFits::conductivity(double T, double* lambda) const {
+    using simd::Vec;
+    const Vec logT = std::log(T);
+    const Vec sqrtT = std::sqrt(T);
+    const size_t count = size();
+    for (size_t k = 0; k < count; k += simd::kWidth) {
+        Vec p = Vec::load(m_conductivity.data() + kDegree * m_stride + k);
+        for (size_t c = kDegree; c-- > 0;) {
+            p = fmadd(p, logT, Vec::load(m_conductivity.data() + c * m_stride + k));
+        }
+        Vec value = p * sqrtT;
+        const size_t n = count - k;
+        if (n >= simd::kWidth) value.store(lambda + k);
+        else value.storePartial(lambda + k, n);
+    }
+}
+
+void TransportFits::binaryDiffusion(double T, double P, double* D) const {
+    using simd::Vec;
+    const Vec logT = std::log(T);
+    const Vec scale = T * std::sqrt(T) / P;
+    const size_t count = size();
+
+    // 第 j 行的物种对 (j, j..K-1) 在系数行中连续, 直接写到 D 的第 j 行
+    for (size_t j = 0; j < count; j++) {
+        const size_t first = pairIndex(j, j);
+        const size_t length = count - j;
+        double* row = D + j * count + j;
+        for (size_t i = 0; i < length; i += simd::kWidth) {
+            // 行尾不足一个向量时只读取本行, 最后一行之后没有补齐空间
+            const size_t n = length - i;
+            auto load = [&](size_t c) {
+                const double* p = m_diffusion.data() + c * m_pairStride + first + i;
+                return n >= simd::kWidth ? Vec::load(p) : Vec::loadPartial(p, n);
+            };
+            Vec p = load(kDegree);
+            for (size_t c = kDegree; c-- > 0;) p = fmadd(p, logT, load(c));
+            if (n >= simd::kWidth) (p * scale).store(row + i);
+            else (p * scale).storePartial(row + i, n);
+        }
+    }
+
+    // 下三角按块对称复制, 按列写入时每块只涉及 kBlock 行, 避免大矩阵逐列写入时的缓存缺失
+    constexpr size_t kBlock = 32;
+    for (size_t jb = 0; jb < count; jb += kBlock) {
+        const size_t jEnd = std::min(jb + kBlock, count);
+        for (size_t kb = jb; kb < count; kb += kBlock) {
+            const size_t kEnd = std::min(kb + kBlock, count);
+            for (size_t k = kb; k < kEnd; k++) {
+                for (size_t j = jb; j < jEnd && j < k; j++) D[k * count + j] = D[j * count + k];
+            }
+        }
+    }
+}
+
+void TransportFits::binaryDiffusionPacked(double T, double P, double* D) const {
+    using simd::Vec;
+    const Vec logT = std::log(T);
+    const Vec scale = T * std::sqrt(T) / P;
+    const size_t pairs = pairCount();
+    for (size_t i = 0; i < pairs; i += simd::kWidth) {
+        Vec p = Vec::load(m_diffusion.data() + kDegree * m_pairStride + i);
+        for (size_t c = kDegree; c-- > 0;) {
+            p = fmadd(p, logT, Vec::load(m_diffusion.data() + c * m_pairStride + i));
+        }
+        const size_t n = pairs - i;
+        if (n >= simd::kWidth) (p * scale).store(D + i);
+        else (p * scale).storePartial(D + i, n);
+    }
+}
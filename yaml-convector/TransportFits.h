@@ -0,0 +1,87 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "Mechanism.h"
+
+// ========== 纯物种输运性质拟合 ==========
+// 加载时由 Lennard-Jones 参数计算粘度、导热系数和二元扩散系数, 在热力学数据的公共温度范围内取
+// 50个等距温度点, 按相对误差加权最小二乘拟合为 lnT 的4次多项式(与 Cantera 的默认方式相同):
+//   η = sqrt(T) * p_η(lnT)^2
+//   λ = sqrt(T) * p_λ(lnT)
+//   D_jk = T^1.5 * p_jk(lnT) / P
+// 碰撞积分 Ω(1,1)*、Ω(2,2)* 取 Neufeld 等(1972)的 LJ 关联式, 极性分子按 Brokaw 修正 δ*^2/T*;
+// 极性-非极性分子对的 ε、σ 按非极性分子的极化率修正. 导热系数按 Warnatz 模型分为平动、转动和振动三部分,
+// 转动松弛数按 Parker 公式随温度修正, 所需 cp 取自 NASA7/NASA9 热力学数据.
+// 粘度和导热系数的系数按 (系数序号, 物种) 存放, 物种补齐到向量宽度的整数倍, 计算时每个物种只做几次乘加.
+// D_jk 对称, 只保存 j <= k 的物种对(按行压缩的上三角, 含对角线, 共 K(K+1)/2 对), 同样按 (系数序号, 物种对)
+// 存放: 第 j 行的物种对在每个系数行中连续, 计算时对连续的物种对做向量 Horner.
+
+// 约化碰撞积分, Tstar = kT/ε, deltaStar = μ^2/(2 ε σ^3 4πε0)
+double collisionIntegral11(double Tstar, double deltaStar);
+double collisionIntegral22(double Tstar, double deltaStar);
+
+class TransportFits {
+public:
+    static constexpr size_t kDegree = 4;
+    static constexpr size_t kCoeffCount = kDegree + 1;
+
+    // 拟合点上的最大相对误差
+    struct FitError {
+        double viscosity = 0.0;
+        double conductivity = 0.0;
+        double diffusion = 0.0;
+    };
+
+    TransportFits() = default;
+    // 收录 transportSpecies 中的全部物种. 物种没有 NASA7/NASA9 热力学数据、geometry 不是
+    // atom/linear/nonlinear、直径或势阱深度不为正、组成中有未知元素时抛出 std::runtime_error
+    explicit TransportFits(const MechanismData& mechanism);
+
+    size_t size() const { return m_species.size(); }
+    // 第 k 个物种在 MechanismData::species 中的下标
+    const std::vector<uint32_t>& species() const { return m_species; }
+    // 分子量 [kg/kmol]
+    const std::vector<double>& molecularWeights() const { return m_molecularWeight; }
+    // 拟合温度范围, 范围外的温度按多项式外推
+    double minTemperature() const { return m_Tmin; }
+    double maxTemperature() const { return m_Tmax; }
+    const FitError& fitError() const { return m_fitError; }
+
+    // 粘度 [Pa·s], 输出长度为 size()
+    void viscosity(double T, double* eta) const;
+    // 导热系数 [W/(m·K)], 输出长度为 size()
+    void conductivity(double T, double* lambda) const;
+    // 二元扩散系数 [m^2/s], P 为压力 [Pa], 输出 D[j * size() + k]
+    void binaryDiffusion(double T, double P, double* D) const;
+    // 同上, 只输出上三角: D[pairIndex(j, k)], 长度为 pairCount()
+    void binaryDiffusionPacked(double T, double P, double* D) const;
+
+    // 物种对 (j, k) 在压缩上三角中的下标, j 和 k 可交换
+    size_t pairIndex(size_t j, size_t k) const {
+        if (j > k) std::swap(j, k);
+        return j * size() - j * (j - 1) / 2 + (k - j);
+    }
+    size_t pairCount() const { return size() * (size() + 1) / 2; }
+
+    // 拟合系数(按 lnT 升幂): 粘度和导热系数为 [系数][物种], 二元扩散为 [系数][物种对]
+    const std::vector<double>& viscosityCoeffs() const { return m_viscosity; }
+    const std::vector<double>& conductivityCoeffs() const { return m_conductivity; }
+    const std::vector<double>& diffusionCoeffs() const { return m_diffusion; }
+    size_t stride() const { return m_stride; }
+    size_t pairStride() const { return m_pairStride; }
+
+private:
+    std::vector<uint32_t> m_species;
+    std::vector<double> m_molecularWeight;
+    double m_Tmin = 0.0;
+    double m_Tmax = 0.0;
+    FitError m_fitError;
+
+    size_t m_stride = 0;                // 补齐后的物种数
+    std::vector<double> m_viscosity;    // [系数][物种]
+    std::vector<double> m_conductivity;
+    size_t m_pairStride = 0;            // 补齐后的物种对数
+    std::vector<double> m_diffusion;    // [系数][物种对]
+};
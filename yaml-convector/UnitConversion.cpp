@@ -0,0 +1,95 @@
+#include "UnitConversion.h"
+#include "PhysicalConstants.h"
+#include <charconv>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+struct NamedUnit {
+    std::string_view name;
+    double factor;
+};
+
+// 基本单位到SI的系数
+constexpr NamedUnit kUnits[] = {
+    { "m", 1.0 },
+    { "cm", 1.0e-2 },
+    { "mm", 1.0e-3 },
+    { "s", 1.0 },
+    { "ms", 1.0e-3 },
+    { "min", 60.0 },
+    { "hr", 3600.0 },
+    { "kmol", 1.0 },
+    { "mol", 1.0e-3 },
+    { "molec", 1.0 / Avogadro },
+    { "J", 1.0 },
+    { "kJ", 1.0e3 },
+    { "cal", Calorie },
+    { "kcal", 1.0e3 * Calorie },
+    { "eV", ElectronCharge },
+    { "K", 1.0 },
+};
+
+double baseFactor(std::string_view name, std::string_view units) {
+    for (const auto& unit : kUnits) {
+        if (unit.name == name) return unit.factor;
+    }
+    throw std::runtime_error("未知单位 '" + std::string(name) + "' (" + std::string(units) + ")");
+}
+
+bool isSeparator(char c) {
+    return c == '*' || c == '/' || c == ' ' || c == '\t';
+}
+
+} // namespace
+
+double unitFactor(std::string_view units) {
+    double factor = 1.0;
+    bool inverse = false;
+    size_t i = 0;
+
+    while (i < units.size()) {
+        char c = units[i];
+        if (c == '/') {
+            inverse = true;
+            i++;
+            continue;
+        }
+        if (isSeparator(c)) {
+            i++;
+            continue;
+        }
+
+        size_t end = i;
+        while (end < units.size() && !isSeparator(units[end])) end++;
+        std::string_view token = units.substr(i, end - i);
+        i = end;
+
+        double exponent = 1.0;
+        size_t caret = token.find('^');
+        if (caret != std::string_view::npos) {
+            std::string_view expText = token.substr(caret + 1);
+            auto result = std::from_chars(expText.data(), expText.data() + expText.size(), exponent);
+            if (result.ec != std::errc() || result.ptr != expText.data() + expText.size()) {
+                throw std::runtime_error("无效的单位指数 '" + std::string(token) + "' (" + std::string(units) + ")");
+            }
+            token = token.substr(0, caret);
+        }
+
+        // "1/s" 中的 "1"
+        if (token == "1") continue;
+
+        double base = baseFactor(token, units);
+        factor *= std::pow(base, inverse ? -exponent : exponent);
+    }
+
+    return factor;
+}
+
+double activationEnergyFactor(std::string_view units) {
+    if (units == "K") return GasConstant;
+    if (units == "eV") return ElectronCharge * Avogadro;
+    return unitFactor(units);
+}
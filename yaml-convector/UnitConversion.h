@@ -0,0 +1,17 @@
+#pragma once
+#include <string_view>
+
+// ========== 单位换算 ==========
+// 单位字符串由若干因子组成, 因子之间用 '*'、'/' 或空格分隔, 每个因子可带 "^指数",
+// 例如 "cm^3/mol/s"、"kcal/mol"、"1/s". '/' 之后的所有因子都取倒数(与 Cantera 相同).
+// 支持的因子:
+//   长度 m cm mm; 时间 s ms min hr; 物质的量 kmol mol molec;
+//   能量 J kJ cal kcal eV; 温度 K (仅用于活化能)
+// 遇到未知单位时抛出 std::runtime_error
+
+// 单位字符串换算到SI(m, s, kmol, J)的系数, 空字符串返回1
+double unitFactor(std::string_view units);
+
+// 活化能单位换算到 J/kmol 的系数: 能量/物质的量单位直接换算,
+// "K"(以 Ea/R 给出)乘以气体常数, 单独的 "eV" 按每个分子计
+double activationEnergyFactor(std::string_view units);
@@ -0,0 +1,289 @@
+#include "YamlDocument.h"
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <stdexcept>
+#include <vector>
+#include <yaml-cpp/parser.h>
+
+// ========== 节点视图 ==========
+
+std::string_view YamlNodeView::asString() const {
+    if (!isString()) {
+        throw std::runtime_error("Value is not a string");
+    }
+    const auto& node = m_doc->node(m_index);
+    return m_doc->string(node.range.first, node.range.count);
+}
+
+double YamlNodeView::asNumber() const {
+    if (!isNumber()) {
+        throw std::runtime_error("Value is not a number");
+    }
+    return m_doc->node(m_index).number;
+}
+
+bool YamlNodeView::asBoolean() const {
+    if (!isBoolean()) {
+        throw std::runtime_error("Value is not a boolean");
+    }
+    return m_doc->node(m_index).range.first != 0;
+}
+
+YamlMapView YamlNodeView::asMap() const {
+    if (!isMap()) {
+        throw std::runtime_error("Value is not a map");
+    }
+    const auto& node = m_doc->node(m_index);
+    return YamlMapView(m_doc, node.range.first, node.range.count);
+}
+
+YamlSequenceView YamlNodeView::asSequence() const {
+    if (!isSequence()) {
+        throw std::runtime_error("Value is not a sequence");
+    }
+    const auto& node = m_doc->node(m_index);
+    return YamlSequenceView(m_doc, node.range.first, node.range.count);
+}
+
+uint32_t YamlMapView::find(std::string_view key) const {
+    uint32_t lo = m_first;
+    uint32_t hi = m_first + m_count;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        const auto& node = m_doc->node(mid);
+        int cmp = m_doc->string(node.keyOffset, node.keyLength).compare(key);
+        if (cmp == 0) return mid;
+        if (cmp < 0) lo = mid + 1;
+        else hi = mid;
+    }
+    return m_first + m_count;
+}
+
+YamlNodeView YamlMapView::get(SchemaKey key) const {
+    for (uint32_t i = m_first; i < m_first + m_count; i++) {
+        if (m_doc->node(i).keyId == key) return YamlNodeView(m_doc, i);
+    }
+    return YamlNodeView();
+}
+
+YamlNodeView YamlMapView::at(std::string_view key) const {
+    uint32_t index = find(key);
+    if (index == m_first + m_count) {
+        throw std::out_of_range("map key not found: " + std::string(key));
+    }
+    return YamlNodeView(m_doc, index);
+}
+
+YamlNodeView YamlSequenceView::operator[](size_t i) const {
+    if (i >= m_count) {
+        throw std::out_of_range("sequence index out of range");
+    }
+    return YamlNodeView(m_doc, m_first + static_cast<uint32_t>(i));
+}
+
+// ========== 文档构建 ==========
+
+//按后序方式构建: 子节点先暂存在 m_pending 中, 容器结束时把整段子节点
+//一次性追加到最终节点数组, 从而保证每个容器的子节点连续存放
+class YamlDocumentBuilder : public YAML::EventHandler {
+public:
+    using Node = YamlDocument::Node;
+    using Type = YamlDocument::Type;
+
+    void OnDocumentStart(const YAML::Mark&) override {}
+    void OnDocumentEnd() override {}
+
+    void OnNull(const YAML::Mark&, YAML::anchor_t anchor) override {
+        if (takeKey(std::string())) return;
+        add(Node(), anchor);
+    }
+
+    void OnAlias(const YAML::Mark&, YAML::anchor_t anchor) override {
+        // 别名直接复用锚点节点(子节点区间共享, 不复制子树)
+        auto it = m_anchors.find(anchor);
+        Node node = (it != m_anchors.end()) ? it->second : Node();
+        if (takeKey(node.type == Type::String ? std::string(stringAt(node)) : std::string())) return;
+        add(node, YAML::NullAnchor);
+    }
+
+    void OnScalar(const YAML::Mark&, const std::string& tag,
+        YAML::anchor_t anchor, const std::string& value) override {
+        if (takeKey(value)) return;
+
+        Node node;
+        YamlValue::ScalarInfo scalar = YamlValue::classifyScalar(value, tag);
+        switch (scalar.type) {
+        case Type::Boolean:
+            node.type = Type::Boolean;
+            node.range.first = scalar.boolean ? 1 : 0;
+            break;
+        case Type::Number:
+            node.type = Type::Number;
+            node.number = scalar.number;
+            break;
+        default:
+            node.type = Type::String;
+            node.range.first = appendString(value);
+            node.range.count = static_cast<uint32_t>(value.size());
+            break;
+        }
+        add(node, anchor);
+    }
+
+    void OnSequenceStart(const YAML::Mark&, const std::string&,
+        YAML::anchor_t anchor, YAML::EmitterStyle::value) override {
+        openContainer(Type::Sequence, anchor);
+    }
+
+    void OnSequenceEnd() override { closeContainer(); }
+
+    void OnMapStart(const YAML::Mark&, const std::string&,
+        YAML::anchor_t anchor, YAML::EmitterStyle::value) override {
+        openContainer(Type::Map, anchor);
+    }
+
+    void OnMapEnd() override { closeContainer(); }
+
+    // 把节点数组和字符串池拷贝到同一块内存中
+    YamlDocument finish() {
+        if (m_pending.empty()) {
+            m_pending.push_back(Node());
+        }
+        m_root = static_cast<uint32_t>(m_nodes.size());
+        m_nodes.push_back(m_pending.back());
+        m_pending.clear();
+
+        YamlDocument doc;
+        size_t nodeBytes = m_nodes.size() * sizeof(Node);
+        doc.m_storage.reset(new unsigned char[nodeBytes + m_strings.size()]);
+        std::memcpy(doc.m_storage.get(), m_nodes.data(), nodeBytes);
+        if (!m_strings.empty()) {
+            std::memcpy(doc.m_storage.get() + nodeBytes, m_strings.data(), m_strings.size());
+        }
+        doc.m_nodes = reinterpret_cast<const Node*>(doc.m_storage.get());
+        doc.m_strings = reinterpret_cast<const char*>(doc.m_storage.get() + nodeBytes);
+        doc.m_nodeCount = m_nodes.size();
+        doc.m_stringBytes = m_strings.size();
+        doc.m_root = m_root;
+        return doc;
+    }
+
+private:
+    struct Frame {
+        Type type;
+        YAML::anchor_t anchor;
+        size_t pendingStart;    // 子节点在 m_pending 中的起点
+        bool hasKey = false;
+        uint32_t keyOffset = 0;
+        uint32_t keyLength = 0;
+        SchemaKey keyId = SchemaKey::Unknown;
+    };
+
+    uint32_t appendString(const std::string& value) {
+        if (m_strings.size() + value.size() > UINT32_MAX) {
+            throw std::runtime_error("YAML document too large for arena");
+        }
+        uint32_t offset = static_cast<uint32_t>(m_strings.size());
+        m_strings.insert(m_strings.end(), value.begin(), value.end());
+        return offset;
+    }
+
+    std::string_view stringAt(const Node& node) const {
+        return std::string_view(m_strings.data() + node.range.first, node.range.count);
+    }
+
+    std::string_view keyOf(const Node& node) const {
+        return std::string_view(m_strings.data() + node.keyOffset, node.keyLength);
+    }
+
+    // 映射表中等待键时, 把标量作为键记录下来
+    bool takeKey(const std::string& value) {
+        if (m_stack.empty() || m_stack.back().type != Type::Map || m_stack.back().hasKey) {
+            return false;
+        }
+        Frame& frame = m_stack.back();
+        frame.keyOffset = appendString(value);
+        frame.keyLength = static_cast<uint32_t>(value.size());
+        frame.keyId = internKey(value);
+        frame.hasKey = true;
+        return true;
+    }
+
+    void add(Node node, YAML::anchor_t anchor) {
+        if (anchor != YAML::NullAnchor) {
+            m_anchors[anchor] = node;
+        }
+
+        if (!m_stack.empty()) {
+            Frame& parent = m_stack.back();
+            if (parent.type == Type::Map) {
+                if (!parent.hasKey) {
+                    // 复杂键(映射表/序列作为键)不支持, 按空字符串处理
+                    parent.keyOffset = 0;
+                    parent.keyLength = 0;
+                    parent.keyId = SchemaKey::Unknown;
+                    parent.hasKey = true;
+                    return;
+                }
+                node.keyOffset = parent.keyOffset;
+                node.keyLength = parent.keyLength;
+                node.keyId = parent.keyId;
+                parent.hasKey = false;
+            }
+        }
+        m_pending.push_back(node);
+    }
+
+    void openContainer(Type type, YAML::anchor_t anchor) {
+        m_stack.push_back(Frame{ type, anchor, m_pending.size() });
+    }
+
+    void closeContainer() {
+        Frame frame = m_stack.back();
+        m_stack.pop_back();
+
+        auto first = m_pending.begin() + frame.pendingStart;
+        if (frame.type == Type::Map) {
+            // 按键排序, 重复键保留最后一个(与 std::map 赋值语义一致)
+            std::stable_sort(first, m_pending.end(), [this](const Node& a, const Node& b) {
+                return keyOf(a) < keyOf(b);
+            });
+            auto out = first;
+            for (auto it = first; it != m_pending.end(); ++it) {
+                auto next = it + 1;
+                if (next != m_pending.end() && keyOf(*next) == keyOf(*it)) continue;
+                *out++ = *it;
+            }
+            m_pending.erase(out, m_pending.end());
+            first = m_pending.begin() + frame.pendingStart;
+        }
+
+        if (m_nodes.size() + (m_pending.end() - first) > UINT32_MAX) {
+            throw std::runtime_error("YAML document too large for arena");
+        }
+
+        Node node;
+        node.type = frame.type;
+        node.range.first = static_cast<uint32_t>(m_nodes.size());
+        node.range.count = static_cast<uint32_t>(m_pending.end() - first);
+        m_nodes.insert(m_nodes.end(), first, m_pending.end());
+        m_pending.erase(first, m_pending.end());
+
+        add(node, frame.anchor);
+    }
+
+    std::vector<Node> m_nodes;
+    std::vector<Node> m_pending;
+    std::vector<char> m_strings;
+    std::vector<Frame> m_stack;
+    std::map<YAML::anchor_t, Node> m_anchors;
+    uint32_t m_root = 0;
+};
+
+YamlDocument YamlDocument::parse(std::istream& input) {
+    YAML::Parser parser(input);
+    YamlDocumentBuilder builder;
+    parser.HandleNextDocument(builder);
+    return builder.finish();
+}
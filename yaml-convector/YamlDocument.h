@@ -0,0 +1,218 @@
+#pragma once
+#include <cstdint>
+#include <istream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include "YamlParser.h"
+
+class YamlDocument;
+class YamlMapView;
+class YamlSequenceView;
+
+//扁平化(arena)文档中的节点只读视图, 接口与 YamlValue 保持一致,
+//因此 extractKinetics 等提取函数可以原样运行在 YamlDocument 上.
+//视图只保存文档指针和节点下标, 文档必须比视图活得更久.
+class YamlNodeView {
+public:
+    using Type = YamlValue::Type;
+
+    YamlNodeView() = default;
+    YamlNodeView(const YamlDocument* doc, uint32_t index) : m_doc(doc), m_index(index) {}
+
+    Type type() const;
+
+    // 空视图(例如 YamlMapView::get 未找到)为 false
+    explicit operator bool() const { return m_doc != nullptr; }
+    // 与 YamlMap::get 返回的指针用法一致: field->asString(), *field
+    const YamlNodeView* operator->() const { return this; }
+    const YamlNodeView& operator*() const { return *this; }
+
+    bool isNull() const { return type() == Type::Null; }
+    bool isString() const { return type() == Type::String; }
+    bool isNumber() const { return type() == Type::Number; }
+    bool isBoolean() const { return type() == Type::Boolean; }
+    bool isMap() const { return type() == Type::Map; }
+    bool isSequence() const { return type() == Type::Sequence; }
+
+    std::string_view asString() const;
+    double asNumber() const;
+    bool asBoolean() const;
+    YamlMapView asMap() const;
+    YamlSequenceView asSequence() const;
+
+    // 作为映射表条目时的键
+    std::string_view key() const;
+
+    uint32_t index() const { return m_index; }
+
+private:
+    const YamlDocument* m_doc = nullptr;
+    uint32_t m_index = 0;
+};
+
+//映射表视图: 子节点按键排序连续存放, 查找使用二分法
+class YamlMapView {
+public:
+    class iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<std::string_view, YamlNodeView>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = value_type;
+
+        iterator(const YamlDocument* doc, uint32_t index) : m_doc(doc), m_index(index) {}
+
+        value_type operator*() const;
+        iterator& operator++() { ++m_index; return *this; }
+        bool operator==(const iterator& other) const { return m_index == other.m_index; }
+        bool operator!=(const iterator& other) const { return m_index != other.m_index; }
+
+    private:
+        const YamlDocument* m_doc;
+        uint32_t m_index;
+    };
+
+    YamlMapView(const YamlDocument* doc, uint32_t first, uint32_t count)
+        : m_doc(doc), m_first(first), m_count(count) {}
+
+    size_t size() const { return m_count; }
+    bool empty() const { return m_count == 0; }
+
+    // 与 std::map 一致: count 返回0或1, at 找不到时抛出 std::out_of_range
+    size_t count(std::string_view key) const { return find(key) != m_first + m_count ? 1 : 0; }
+    YamlNodeView at(std::string_view key) const;
+    // 按模式键查找(比较节点中预先计算的键ID), 找不到时返回空视图
+    YamlNodeView get(SchemaKey key) const;
+
+    iterator begin() const { return iterator(m_doc, m_first); }
+    iterator end() const { return iterator(m_doc, m_first + m_count); }
+
+private:
+    // 返回节点下标, 找不到时返回 m_first + m_count
+    uint32_t find(std::string_view key) const;
+
+    const YamlDocument* m_doc;
+    uint32_t m_first;
+    uint32_t m_count;
+};
+
+//序列视图: 子节点连续存放
+class YamlSequenceView {
+public:
+    class iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = YamlNodeView;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = YamlNodeView;
+
+        iterator(const YamlDocument* doc, uint32_t index) : m_doc(doc), m_index(index) {}
+
+        YamlNodeView operator*() const { return YamlNodeView(m_doc, m_index); }
+        iterator& operator++() { ++m_index; return *this; }
+        bool operator==(const iterator& other) const { return m_index == other.m_index; }
+        bool operator!=(const iterator& other) const { return m_index != other.m_index; }
+
+    private:
+        const YamlDocument* m_doc;
+        uint32_t m_index;
+    };
+
+    YamlSequenceView(const YamlDocument* doc, uint32_t first, uint32_t count)
+        : m_doc(doc), m_first(first), m_count(count) {}
+
+    size_t size() const { return m_count; }
+    bool empty() const { return m_count == 0; }
+
+    // 越界时抛出 std::out_of_range
+    YamlNodeView operator[](size_t i) const;
+
+    iterator begin() const { return iterator(m_doc, m_first); }
+    iterator end() const { return iterator(m_doc, m_first + m_count); }
+
+private:
+    const YamlDocument* m_doc;
+    uint32_t m_first;
+    uint32_t m_count;
+};
+
+//扁平化只读文档: 所有节点存放在一个连续数组中, 字符串(键和字符串标量)存放在字符串池中,
+//容器的子节点在数组中连续存放, 用 [first, first + count) 下标区间引用.
+//节点数组和字符串池位于同一块内存中, 整个文档只需一次释放.
+//由 yaml-cpp 的解析事件直接构建, 不生成 YAML::Node 和 YamlValue 树.
+class YamlDocument {
+public:
+    using Type = YamlValue::Type;
+
+    // 节点的紧凑存储(24字节)
+    struct Node {
+        uint32_t keyOffset = 0;     // 作为映射表条目时键在字符串池中的位置
+        uint32_t keyLength = 0;
+        union {
+            double number;
+            struct {
+                uint32_t first;     // 字符串: 字符串池偏移; 容器: 第一个子节点下标; 布尔: 值
+                uint32_t count;     // 字符串: 长度; 容器: 子节点数
+            } range;
+        };
+        Type type = Type::Null;
+        SchemaKey keyId = SchemaKey::Unknown;   // 键的模式键ID, 占用原有的对齐填充
+
+        Node() : range{ 0, 0 } {}
+    };
+
+    YamlDocument() = default;
+    YamlDocument(YamlDocument&&) noexcept = default;
+    YamlDocument& operator=(YamlDocument&&) noexcept = default;
+    YamlDocument(const YamlDocument&) = delete;
+    YamlDocument& operator=(const YamlDocument&) = delete;
+
+    // 解析输入流中的第一个YAML文档, 语法错误时抛出 YAML::Exception
+    static YamlDocument parse(std::istream& input);
+
+    // 根节点(空文档时为 Null)
+    YamlNodeView root() const { return YamlNodeView(this, m_root); }
+
+    const Node& node(uint32_t index) const { return m_nodes[index]; }
+    std::string_view string(uint32_t offset, uint32_t length) const {
+        return std::string_view(m_strings + offset, length);
+    }
+
+    size_t nodeCount() const { return m_nodeCount; }
+    size_t stringBytes() const { return m_stringBytes; }
+    // 文档占用的总字节数(唯一的一块内存)
+    size_t memoryBytes() const { return m_nodeCount * sizeof(Node) + m_stringBytes; }
+
+private:
+    friend class YamlDocumentBuilder;
+
+    std::unique_ptr<unsigned char[]> m_storage;
+    const Node* m_nodes = nullptr;
+    const char* m_strings = nullptr;
+    size_t m_nodeCount = 0;
+    size_t m_stringBytes = 0;
+    uint32_t m_root = 0;
+};
+
+static_assert(sizeof(YamlDocument::Node) == 24, "YamlDocument::Node must stay 24 bytes");
+
+// ========== 内联实现 ==========
+
+inline YamlNodeView::Type YamlNodeView::type() const {
+    return m_doc ? m_doc->node(m_index).type : Type::Null;
+}
+
+inline std::string_view YamlNodeView::key() const {
+    const auto& node = m_doc->node(m_index);
+    return m_doc->string(node.keyOffset, node.keyLength);
+}
+
+inline YamlMapView::iterator::value_type YamlMapView::iterator::operator*() const {
+    YamlNodeView child(m_doc, m_index);
+    return value_type(child.key(), child);
+}
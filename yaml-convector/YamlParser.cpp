@@ -1,130 +1,311 @@
 #include "YamlParser.h"
+#include "YamlDocument.h"
+#include <charconv>
+#include <limits>
+#include <sstream>
 #include <iostream>
 #include <fstream>
 
 // 将YAML::Node转换为YamlValue
 YamlValue::YamlValue(const YAML::Node& node) {
     if (node.IsNull()) {
-        m_type = Type::Null;
+        m_value = std::monostate();
     }
     else if (node.IsScalar()) {
-        // 解析标量值
-        std::string value = node.Scalar();
-
-        // 尝试解析为布尔值
-        if (value == "true" || value == "yes" || value == "True") {
-            m_type = Type::Boolean;
-            m_bool = true;
-        }
-        else if (value == "false" || value == "no" || value == "False") {
-            m_type = Type::Boolean;
-            m_bool = false;
-        }
-        else {
-            // 检查是否是带引号的字符串（使用YAML底层API）
-            if (node.Tag() == "!") { // YAML中的显式字符串标签
-                m_type = Type::String;
-                m_string = value;
-            } else {
-                // 检查是否是以数字开头但包含非数字字符的值
-                bool hasNonDigit = false;
-                for (char c : value) {
-                    if (!std::isdigit(c) && c != '.' && c != 'e' && c != 'E' && c != '-' && c != '+') {
-                        hasNonDigit = true;
-                        break;
-                    }
-                }
-                
-                if (hasNonDigit && std::isdigit(value[0])) {
-                    // 如果以数字开头但包含非数字字符，强制作为字符串
-                    m_type = Type::String;
-                    m_string = value;
-                } else {
-                    // 尝试解析为数字
-                    try {
-                        m_number = std::stod(value);
-                        m_type = Type::Number;
-                    }
-                    catch (...) {
-                        // 默认为字符串
-                        m_type = Type::String;
-                        m_string = value;
-                    }
-                }
-            }
-        }
+        *this = fromScalar(node.Scalar(), node.Tag());
     }
     else if (node.IsMap()) {
         // 解析Map
-        m_type = Type::Map;
+        auto map = std::make_unique<MapType>();
         for (const auto& kv : node) {
             std::string key = kv.first.Scalar();
-            m_map[key] = YamlValue(kv.second);
+            (*map)[key] = YamlValue(kv.second);
         }
+        map->buildKeyIndex();
+        m_value = std::move(map);
     }
     else if (node.IsSequence()) {
         // 解析序列
-        m_type = Type::Sequence;
+        auto sequence = std::make_unique<SequenceType>();
+        sequence->reserve(node.size());
         for (const auto& item : node) {
-            m_sequence.push_back(YamlValue(item));
+            sequence->push_back(YamlValue(item));
+        }
+        m_value = std::move(sequence);
+    }
+}
+
+YamlValue::YamlValue(MapType value) : m_value(std::make_unique<MapType>(std::move(value))) {
+    std::get<std::unique_ptr<MapType>>(m_value)->buildKeyIndex();
+}
+
+YamlValue::~YamlValue() = default;
+
+YamlValue::YamlValue(const YamlValue& other) {
+    *this = other;
+}
+
+YamlValue& YamlValue::operator=(const YamlValue& other) {
+    if (this == &other) {
+        return *this;
+    }
+
+    // 延迟值的拷贝仍为延迟值, 共享底层 YAML::Node
+    if (other.isLazy()) {
+        const auto& lazyNode = *std::get<std::unique_ptr<LazyNode>>(other.m_value);
+        m_value = std::make_unique<LazyNode>(lazyNode.node, lazyNode.type);
+        return *this;
+    }
+
+    switch (other.type()) {
+    case Type::Map:
+        m_value = std::make_unique<MapType>(other.asMap());
+        break;
+    case Type::Sequence:
+        m_value = std::make_unique<SequenceType>(other.asSequence());
+        break;
+    case Type::String:
+        m_value = std::get<std::string>(other.m_value);
+        break;
+    case Type::Number:
+        m_value = std::get<double>(other.m_value);
+        break;
+    case Type::Boolean:
+        m_value = std::get<bool>(other.m_value);
+        break;
+    default:
+        m_value = std::monostate();
+        break;
+    }
+
+    return *this;
+}
+
+// ========== 延迟转换 ==========
+
+YamlValue YamlValue::lazy(const YAML::Node& node) {
+    YamlValue result;
+    if (node.IsScalar()) {
+        result = fromScalar(node.Scalar(), node.Tag());
+    }
+    else if (node.IsMap()) {
+        result.m_value = std::make_unique<LazyNode>(node, Type::Map);
+    }
+    else if (node.IsSequence()) {
+        result.m_value = std::make_unique<LazyNode>(node, Type::Sequence);
+    }
+    return result;
+}
+
+YamlValue::LazyNode::LazyNode(const YAML::Node& source, Type containerType)
+    : node(source), type(containerType) {}
+
+YamlValue::LazyNode::~LazyNode() = default;
+
+void YamlValue::LazyNode::materialize() {
+    std::call_once(once, [this]() {
+        if (type == Type::Map) {
+            auto result = std::make_unique<MapType>();
+            for (const auto& kv : node) {
+                (*result)[kv.first.Scalar()] = YamlValue::lazy(kv.second);
+            }
+            result->buildKeyIndex();
+            map = std::move(result);
         }
+        else {
+            auto result = std::make_unique<SequenceType>();
+            result->reserve(node.size());
+            for (const auto& item : node) {
+                result->push_back(YamlValue::lazy(item));
+            }
+            sequence = std::move(result);
+        }
+    });
+}
+
+YamlValue::Type YamlValue::lazyType() const {
+    return std::get<std::unique_ptr<LazyNode>>(m_value)->type;
+}
+
+// ========== YamlMap ==========
+
+YamlMap& YamlMap::operator=(const YamlMap& other) {
+    if (this != &other) {
+        Base::operator=(other);
+        buildKeyIndex();
+    }
+    return *this;
+}
+
+void YamlMap::buildKeyIndex() {
+    // 先按ID放入临时槽位, 再按ID顺序压紧
+    const YamlValue* byKey[static_cast<size_t>(SchemaKey::Count)];
+    m_keyMask = 0;
+    for (const auto& [key, value] : *this) {
+        SchemaKey id = internKey(key);
+        if (id != SchemaKey::Unknown) {
+            byKey[static_cast<size_t>(id)] = &value;
+            m_keyMask |= uint64_t(1) << static_cast<unsigned>(id);
+        }
+    }
+
+    const size_t count = bitCount(m_keyMask);
+    m_overflow.reset(count > kInlineSlots ? new const YamlValue*[count] : nullptr);
+    const YamlValue** values = m_overflow ? m_overflow.get() : m_inline;
+    size_t slot = 0;
+    for (size_t id = 1; id < static_cast<size_t>(SchemaKey::Count); id++) {
+        if (m_keyMask & (uint64_t(1) << id)) values[slot++] = byKey[id];
+    }
+}
+
+namespace {
+
+// YAML 的特殊浮点值 .inf/.nan(不含正负号)
+bool parseSpecialFloat(std::string_view text, double& number) {
+    if (text == ".inf" || text == ".Inf" || text == ".INF") {
+        number = std::numeric_limits<double>::infinity();
+        return true;
+    }
+    if (text == ".nan" || text == ".NaN" || text == ".NAN") {
+        number = std::numeric_limits<double>::quiet_NaN();
+        return true;
+    }
+    return false;
+}
+
+} // namespace
+
+YamlValue::ScalarInfo YamlValue::classifyScalar(std::string_view value, std::string_view tag) {
+    ScalarInfo info;
+
+    // 带引号的标量始终是字符串
+    if (tag == "!" || value.empty()) {
+        return info;
+    }
+
+    // 布尔值: 按长度和首字母分派, 不逐个比较所有拼写
+    switch (value.size()) {
+    case 2:
+        if (value == "no") { info.type = Type::Boolean; return info; }
+        break;
+    case 3:
+        if (value == "yes") { info.type = Type::Boolean; info.boolean = true; return info; }
+        break;
+    case 4:
+        if (value == "true" || value == "True") { info.type = Type::Boolean; info.boolean = true; return info; }
+        break;
+    case 5:
+        if (value == "false" || value == "False") { info.type = Type::Boolean; return info; }
+        break;
+    default:
+        break;
+    }
+
+    // 数值: 可选正负号后必须是数字或小数点, 名称/单位等字符串在这里直接返回
+    std::string_view digits = value;
+    bool negative = false;
+    if (digits[0] == '+' || digits[0] == '-') {
+        negative = digits[0] == '-';
+        digits.remove_prefix(1);
+    }
+    if (digits.empty() || !((digits[0] >= '0' && digits[0] <= '9') || digits[0] == '.')) {
+        return info;
     }
+
+    double number = 0.0;
+    if (parseSpecialFloat(digits, number)) {
+        info.type = Type::Number;
+        info.number = negative ? -number : number;
+        return info;
+    }
+
+    // from_chars 不接受前导'+', 负号保留给它处理; 必须完整消耗文本且不溢出
+    const char* first = negative ? value.data() : digits.data();
+    const char* last = value.data() + value.size();
+    auto [ptr, ec] = std::from_chars(first, last, number);
+    if (ec == std::errc() && ptr == last) {
+        info.type = Type::Number;
+        info.number = number;
+    }
+    return info;
 }
 
-std::string YamlValue::asString() const {
+YamlValue YamlValue::fromScalar(const std::string& value, const std::string& tag) {
+    ScalarInfo info = classifyScalar(value, tag);
+    switch (info.type) {
+    case Type::Boolean:
+        return YamlValue(info.boolean);
+    case Type::Number:
+        return YamlValue(info.number);
+    default:
+        return YamlValue(value);
+    }
+}
+
+const std::string& YamlValue::asString() const {
     if (!isString()) {
         throw std::runtime_error("Value is not a string");
     }
-    return m_string;
+    return std::get<std::string>(m_value);
 }
 
 double YamlValue::asNumber() const {
     if (!isNumber()) {
         throw std::runtime_error("Value is not a number");
     }
-    return m_number;
+    return std::get<double>(m_value);
 }
 
 bool YamlValue::asBoolean() const {
     if (!isBoolean()) {
         throw std::runtime_error("Value is not a boolean");
     }
-    return m_bool;
+    return std::get<bool>(m_value);
 }
 
-const std::map<std::string, YamlValue>& YamlValue::asMap() const {
+const YamlValue::MapType& YamlValue::asMap() const {
     if (!isMap()) {
         throw std::runtime_error("Value is not a map");
     }
-    return m_map;
+    if (isLazy()) {
+        auto& lazyNode = *std::get<std::unique_ptr<LazyNode>>(m_value);
+        lazyNode.materialize();
+        return *lazyNode.map;
+    }
+    return *std::get<std::unique_ptr<MapType>>(m_value);
 }
 
-const std::vector<YamlValue>& YamlValue::asSequence() const {
+const YamlValue::SequenceType& YamlValue::asSequence() const {
     if (!isSequence()) {
         throw std::runtime_error("Value is not a sequence");
     }
-    return m_sequence;
+    if (isLazy()) {
+        auto& lazyNode = *std::get<std::unique_ptr<LazyNode>>(m_value);
+        lazyNode.materialize();
+        return *lazyNode.sequence;
+    }
+    return *std::get<std::unique_ptr<SequenceType>>(m_value);
 }
 
 void YamlValue::print(int indent) const {
     std::string spaces(indent * 2, ' ');
 
-    switch (m_type) {
+    switch (type()) {
     case Type::Null:
         std::cout << spaces << "null" << std::endl;
         break;
     case Type::String:
-        std::cout << spaces << "\"" << m_string << "\"" << std::endl;
+        std::cout << spaces << "\"" << asString() << "\"" << std::endl;
         break;
     case Type::Number:
-        std::cout << spaces << m_number << std::endl;
+        std::cout << spaces << asNumber() << std::endl;
         break;
     case Type::Boolean:
-        std::cout << spaces << (m_bool ? "true" : "false") << std::endl;
+        std::cout << spaces << (asBoolean() ? "true" : "false") << std::endl;
         break;
     case Type::Map:
         std::cout << spaces << "{" << std::endl;
-        for (const auto& [key, value] : m_map) {
+        for (const auto& [key, value] : asMap()) {
             std::cout << spaces << "  " << key << ": ";
             value.print(indent + 1);
         }
@@ -132,7 +313,7 @@ void YamlValue::print(int indent) const {
         break;
     case Type::Sequence:
         std::cout << spaces << "[" << std::endl;
-        for (const auto& value : m_sequence) {
+        for (const auto& value : asSequence()) {
             std::cout << spaces << "  - ";
             value.print(indent + 1);
         }
@@ -141,6 +322,93 @@ void YamlValue::print(int indent) const {
     }
 }
 
+// ========== YamlNodeBuilder ==========
+
+void YamlNodeBuilder::add(YamlValue value, YAML::anchor_t anchor) {
+    if (anchor != YAML::NullAnchor) {
+        m_anchors[anchor] = value;
+    }
+
+    if (m_stack.empty()) {
+        m_result = std::move(value);
+        m_done = true;
+        return;
+    }
+
+    Frame& parent = m_stack.back();
+    if (parent.value.isSequence()) {
+        std::get<std::unique_ptr<YamlValue::SequenceType>>(parent.value.m_value)->push_back(std::move(value));
+    }
+    else if (!parent.hasKey) {
+        // 复杂键(映射表/序列作为键)不支持, 按空字符串处理
+        parent.key = value.isString() ? value.asString() : std::string();
+        parent.hasKey = true;
+    }
+    else {
+        (*std::get<std::unique_ptr<YamlValue::MapType>>(parent.value.m_value))[parent.key] = std::move(value);
+        parent.hasKey = false;
+    }
+}
+
+void YamlNodeBuilder::OnNull(const YAML::Mark&, YAML::anchor_t anchor) {
+    add(YamlValue(), anchor);
+}
+
+void YamlNodeBuilder::OnAlias(const YAML::Mark&, YAML::anchor_t anchor) {
+    // 未记录的锚点(例如在被跳过的节点中定义)按空值处理
+    auto it = m_anchors.find(anchor);
+    add(it != m_anchors.end() ? it->second : YamlValue(), YAML::NullAnchor);
+}
+
+void YamlNodeBuilder::OnScalar(const YAML::Mark&, const std::string& tag,
+    YAML::anchor_t anchor, const std::string& value) {
+    // 映射表的键保持原始文本, 不做类型推断
+    if (!m_stack.empty() && m_stack.back().value.isMap()
+        && !m_stack.back().hasKey) {
+        m_stack.back().key = value;
+        m_stack.back().hasKey = true;
+        return;
+    }
+
+    add(YamlValue::fromScalar(value, tag), anchor);
+}
+
+void YamlNodeBuilder::OnSequenceStart(const YAML::Mark&, const std::string&,
+    YAML::anchor_t anchor, YAML::EmitterStyle::value) {
+    Frame frame;
+    frame.value = YamlValue(YamlValue::SequenceType());
+    frame.anchor = anchor;
+    m_stack.push_back(std::move(frame));
+}
+
+void YamlNodeBuilder::OnSequenceEnd() {
+    Frame frame = std::move(m_stack.back());
+    m_stack.pop_back();
+    add(std::move(frame.value), frame.anchor);
+}
+
+void YamlNodeBuilder::OnMapStart(const YAML::Mark&, const std::string&,
+    YAML::anchor_t anchor, YAML::EmitterStyle::value) {
+    Frame frame;
+    frame.value = YamlValue(YamlValue::MapType());
+    frame.anchor = anchor;
+    m_stack.push_back(std::move(frame));
+}
+
+void YamlNodeBuilder::OnMapEnd() {
+    Frame frame = std::move(m_stack.back());
+    m_stack.pop_back();
+    std::get<std::unique_ptr<YamlValue::MapType>>(frame.value.m_value)->buildKeyIndex();
+    add(std::move(frame.value), frame.anchor);
+}
+
+YamlValue YamlNodeBuilder::take() {
+    YamlValue result = std::move(m_result);
+    m_result = YamlValue();
+    m_done = false;
+    return result;
+}
+
 YamlValue YamlParser::loadFile(const std::string& filename) {
     try {
         YAML::Node rootNode = YAML::LoadFile(filename);
@@ -161,3 +429,45 @@ YamlValue YamlParser::loadString(const std::string& yaml) {
     }
 }
 
+YamlValue YamlParser::loadFileLazy(const std::string& filename) {
+    try {
+        return YamlValue::lazy(YAML::LoadFile(filename));
+    }
+    catch (const YAML::Exception& e) {
+        throw std::runtime_error("YAML parsing error: " + std::string(e.what()));
+    }
+}
+
+YamlValue YamlParser::loadStringLazy(const std::string& yaml) {
+    try {
+        return YamlValue::lazy(YAML::Load(yaml));
+    }
+    catch (const YAML::Exception& e) {
+        throw std::runtime_error("YAML parsing error: " + std::string(e.what()));
+    }
+}
+
+YamlDocument YamlParser::loadDocument(const std::string& filename) {
+    std::ifstream input(filename, std::ios::binary);
+    if (!input) {
+        throw std::runtime_error("YAML parsing error: bad file: " + filename);
+    }
+
+    try {
+        return YamlDocument::parse(input);
+    }
+    catch (const YAML::Exception& e) {
+        throw std::runtime_error("YAML parsing error: " + std::string(e.what()));
+    }
+}
+
+YamlDocument YamlParser::loadDocumentString(const std::string& yaml) {
+    std::istringstream input(yaml);
+
+    try {
+        return YamlDocument::parse(input);
+    }
+    catch (const YAML::Exception& e) {
+        throw std::runtime_error("YAML parsing error: " + std::string(e.what()));
+    }
+}
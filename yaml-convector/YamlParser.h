@@ -1,52 +1,226 @@
 #pragma once
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
 #include <string>
+#include <string_view>
 #include <map>
 #include <vector>
-#include <any>
+#include <memory>
+#include <mutex>
+#include <variant>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 #include <yaml-cpp/yaml.h>// 包含yaml-cpp库，这是实际的YAML解析引擎
+#include <yaml-cpp/eventhandler.h>
+#include "SchemaKeys.h"
 
+class YamlDocument;
+class YamlMap;
 
+//标签联合: 每个节点只保存当前类型的数据, 映射表和序列放在堆上,
+//标量节点(数字/布尔/短字符串)不再携带空的map和vector
 class YamlValue {
 public:
     //map :映射表(键值对集合)    sequence :序列(元素集合)
+    //枚举顺序与 m_value 的备选类型顺序一致
     enum class Type {
         Null, String, Number, Boolean, Map, Sequence
     };
 
-    
-    YamlValue() : m_type(Type::Null) {}
-    YamlValue(const std::string& value) : m_type(Type::String), m_string(value) {}
-    YamlValue(double value) : m_type(Type::Number), m_number(value) {}
-    YamlValue(bool value) : m_type(Type::Boolean), m_bool(value) {}
+    using MapType = YamlMap;
+    using SequenceType = std::vector<YamlValue>;
+
+    YamlValue() = default;
+    YamlValue(const std::string& value) : m_value(value) {}
+    YamlValue(double value) : m_value(value) {}
+    explicit YamlValue(bool value) : m_value(value) {}
+    explicit YamlValue(MapType value);
+    explicit YamlValue(SequenceType value) : m_value(std::make_unique<SequenceType>(std::move(value))) {}
 
     
     YamlValue(const YAML::Node& node);
 
-    
-    bool isNull() const { return m_type == Type::Null; }
-    bool isString() const { return m_type == Type::String; }
-    bool isNumber() const { return m_type == Type::Number; }
-    bool isBoolean() const { return m_type == Type::Boolean; }
-    bool isMap() const { return m_type == Type::Map; }
-    bool isSequence() const { return m_type == Type::Sequence; }
+    // 延迟转换: 标量立即转换, 映射表和序列只保存 YAML::Node,
+    // 第一次调用 asMap()/asSequence() 时才转换一层(子节点仍为延迟值), 结果缓存.
+    // 每个延迟容器只转换一次(std::call_once), 多个线程同时访问时也是如此
+    static YamlValue lazy(const YAML::Node& node);
+
+    // 容器在堆上, 拷贝时深拷贝, 移动时只转移指针
+    YamlValue(const YamlValue& other);
+    YamlValue(YamlValue&& other) noexcept = default;
+    YamlValue& operator=(const YamlValue& other);
+    YamlValue& operator=(YamlValue&& other) noexcept = default;
+    ~YamlValue();
+
+    // 标量类型推断的结果, 字符串时 number 和 boolean 无意义
+    struct ScalarInfo {
+        Type type = Type::String;
+        double number = 0.0;
+        bool boolean = false;
+    };
+
+    // 单次扫描推断标量类型, 不抛出异常. 标签为"!"表示带引号的字符串, 一律按字符串处理;
+    // true/True/yes 和 false/False/no 为布尔值; 整个文本符合浮点数语法(可带正负号,
+    // 以及 .inf/.nan)且不溢出时为数值; 其余均为字符串
+    static ScalarInfo classifyScalar(std::string_view value, std::string_view tag);
+
+    // 根据标量文本和标签构造 YamlValue, 规则同 classifyScalar
+    static YamlValue fromScalar(const std::string& value, const std::string& tag);
+
+    Type type() const {
+        size_t index = m_value.index();
+        return index < kLazyIndex ? static_cast<Type>(index) : lazyType();
+    }
+
+    // 是否为尚未转换或已转换的延迟容器
+    bool isLazy() const { return m_value.index() == kLazyIndex; }
+
+    bool isNull() const { return type() == Type::Null; }
+    bool isString() const { return type() == Type::String; }
+    bool isNumber() const { return type() == Type::Number; }
+    bool isBoolean() const { return type() == Type::Boolean; }
+    bool isMap() const { return type() == Type::Map; }
+    bool isSequence() const { return type() == Type::Sequence; }
 
     
-    std::string asString() const;
+    const std::string& asString() const;
     double asNumber() const;
     bool asBoolean() const;
-    const std::map<std::string, YamlValue>& asMap() const;
-    const std::vector<YamlValue>& asSequence() const;
+    const MapType& asMap() const;
+    const SequenceType& asSequence() const;
 
     
     void print(int indent = 0) const;
 
 private:
-    Type m_type;
-    std::string m_string;
-    double m_number = 0.0;
-    bool m_bool = false;
-    std::map<std::string, YamlValue> m_map;
-    std::vector<YamlValue> m_sequence;
+    friend class YamlNodeBuilder;
+
+    // 延迟容器: 原始节点 + 首次访问时转换的结果
+    struct LazyNode {
+        YAML::Node node;
+        Type type;
+        std::once_flag once;
+        std::unique_ptr<MapType> map;
+        std::unique_ptr<SequenceType> sequence;
+
+        LazyNode(const YAML::Node& source, Type containerType);
+        ~LazyNode();
+        void materialize();
+    };
+
+    static constexpr size_t kLazyIndex = 6;
+
+    Type lazyType() const;
+
+    std::variant<std::monostate, std::string, double, bool,
+        std::unique_ptr<MapType>, std::unique_ptr<SequenceType>,
+        std::unique_ptr<LazyNode>> m_value;
+};
+
+//映射表: 在 std::map 的基础上附带模式键槽位(见 SchemaKeys.h): 64位掩码记录出现的模式键ID,
+//对应的值按ID顺序存放, get(SchemaKey) 由掩码直接算出槽位, 不扫描、不做字符串比较.
+//槽位通常不超过 kInlineSlots 个, 直接放在映射表对象中, 与映射表一起分配; 更多时放在堆上.
+//槽位在映射表填充完成(解析时)由 buildKeyIndex() 生成, 拷贝时自动重建.
+class YamlMap : public std::map<std::string, YamlValue> {
+public:
+    using Base = std::map<std::string, YamlValue>;
+
+    YamlMap() = default;
+    YamlMap(const YamlMap& other) : Base(other) { buildKeyIndex(); }
+    YamlMap(YamlMap&& other) noexcept : Base(std::move(other)) { takeKeyIndex(other); }
+    YamlMap& operator=(const YamlMap& other);
+    YamlMap& operator=(YamlMap&& other) noexcept {
+        Base::operator=(std::move(other));
+        takeKeyIndex(other);
+        return *this;
+    }
+
+    // 按模式键查找, 找不到时返回 nullptr
+    const YamlValue* get(SchemaKey key) const {
+        const uint64_t bit = uint64_t(1) << static_cast<unsigned>(key);
+        if (!(m_keyMask & bit)) return nullptr;
+        const YamlValue* const* values = m_overflow ? m_overflow.get() : m_inline;
+        return values[bitCount(m_keyMask & (bit - 1))];
+    }
+
+    // 插入元素后重建模式键槽位
+    void buildKeyIndex();
+
+    size_t keyIndexSize() const { return bitCount(m_keyMask); }
+    // 槽位占用的额外堆内存(槽位放在对象内时为0)
+    size_t keyIndexHeapBytes() const { return m_overflow ? keyIndexSize() * sizeof(const YamlValue*) : 0; }
+
+private:
+    static_assert(static_cast<size_t>(SchemaKey::Count) <= 64, "SchemaKey mask is 64 bits");
+
+    static unsigned bitCount(uint64_t x) {
+#if defined(_MSC_VER)
+        return static_cast<unsigned>(__popcnt64(x));
+#else
+        return static_cast<unsigned>(__builtin_popcountll(x));
+#endif
+    }
+
+    static constexpr size_t kInlineSlots = 6;
+
+    // 移动时接管槽位, 被移动的映射表已为空, 槽位清零
+    void takeKeyIndex(YamlMap& other) noexcept {
+        m_keyMask = other.m_keyMask;
+        std::copy(std::begin(other.m_inline), std::end(other.m_inline), m_inline);
+        m_overflow = std::move(other.m_overflow);
+        other.m_keyMask = 0;
+    }
+
+    // 槽位中的值按ID升序; std::map 的节点地址在移动时不变, 移动后槽位仍然有效
+    uint64_t m_keyMask = 0;                             // 第 i 位: 含有 ID 为 i 的模式键(Unknown 恒为0)
+    const YamlValue* m_inline[kInlineSlots] = {};
+    std::unique_ptr<const YamlValue*[]> m_overflow;     // 超过 kInlineSlots 个时使用
+};
+
+//由yaml-cpp解析事件直接构建YamlValue, 不经过YAML::Node
+//每次构建一个完整节点, 完成后用take()取出, 之后可继续构建下一个节点
+//带锚点的节点会保留副本, 在同一构建器后续构建的节点中可以被别名引用
+class YamlNodeBuilder : public YAML::EventHandler {
+public:
+    void OnDocumentStart(const YAML::Mark&) override {}
+    void OnDocumentEnd() override {}
+
+    void OnNull(const YAML::Mark& mark, YAML::anchor_t anchor) override;
+    void OnAlias(const YAML::Mark& mark, YAML::anchor_t anchor) override;
+    void OnScalar(const YAML::Mark& mark, const std::string& tag,
+        YAML::anchor_t anchor, const std::string& value) override;
+
+    void OnSequenceStart(const YAML::Mark& mark, const std::string& tag,
+        YAML::anchor_t anchor, YAML::EmitterStyle::value style) override;
+    void OnSequenceEnd() override;
+
+    void OnMapStart(const YAML::Mark& mark, const std::string& tag,
+        YAML::anchor_t anchor, YAML::EmitterStyle::value style) override;
+    void OnMapEnd() override;
+
+    // 是否已构建完成一个节点
+    bool done() const { return m_done; }
+
+    // 取出构建完成的节点, 构建器可继续构建下一个节点
+    YamlValue take();
+
+private:
+    struct Frame {
+        YamlValue value;
+        YAML::anchor_t anchor = YAML::NullAnchor;
+        std::string key;
+        bool hasKey = false;
+    };
+
+    // 把一个完成的子节点挂到父容器上, 或作为最终结果
+    void add(YamlValue value, YAML::anchor_t anchor);
+
+    std::vector<Frame> m_stack;
+    std::map<YAML::anchor_t, YamlValue> m_anchors;
+    YamlValue m_result;
+    bool m_done = false;
 };
 
 //将解析结果封装成YamlValue对象返回,文件或字符串 → yaml-cpp解析 → YAML::Node → YamlValue转换 → 用户代码
@@ -57,5 +231,15 @@ public:
 
     
     static YamlValue loadString(const std::string& yaml);
+
+    // 延迟模式(见 YamlValue::lazy): 只转换实际访问到的子树
+    static YamlValue loadFileLazy(const std::string& filename);
+
+    static YamlValue loadStringLazy(const std::string& yaml);
+
+    // 解析为扁平化只读文档(见 YamlDocument.h), 不生成 YAML::Node 和 YamlValue 树
+    static YamlDocument loadDocument(const std::string& filename);
+
+    static YamlDocument loadDocumentString(const std::string& yaml);
 };
 